@@ -0,0 +1,201 @@
+#include "ast/ContractCache.h"
+#include "gen/Generator.h"
+
+#include "CliApp.h"
+
+#include <mutex>
+#include <atomic>
+#include <thread>
+#include <vector>
+#include <sstream>
+#include <fstream>
+#include <iostream>
+#include <filesystem>
+
+struct BatchOptions: GeneratorOptions
+{
+	struct Job
+	{
+		std::filesystem::path input, output;
+	};
+
+	std::vector<Job> jobs;
+	std::optional<std::filesystem::path> pendingInput;
+	unsigned int workers = std::max(1u, std::thread::hardware_concurrency());
+
+	void addInput(const std::filesystem::path& p)
+	{
+		if(pendingInput)
+		{
+			throw std::runtime_error("No output file specified for input '" + pendingInput->string() + "'");
+		}
+
+		pendingInput = p;
+	}
+
+	void addOutput(const std::filesystem::path& p)
+	{
+		if(!pendingInput)
+		{
+			throw std::runtime_error("No input file specified for output '" + p.string() + "'");
+		}
+
+		jobs.push_back({*pendingInput, p});
+		pendingInput.reset();
+	}
+
+	/*
+	 * Each non-empty line of the manifest that does not start with a '#' character names
+	 * an input and an output file separated by whitespace, relative paths are taken to be
+	 * relative to the directory containing the manifest.
+	 */
+	void readManifest(const std::filesystem::path &p)
+	{
+		std::ifstream manifest(p);
+
+		if(!manifest)
+		{
+			throw std::runtime_error("Manifest file '" + std::filesystem::absolute(p).string() + "' could not be opened");
+		}
+
+		const auto base = p.parent_path();
+
+		int lineNumber = 0;
+		for(std::string line; std::getline(manifest, line);)
+		{
+			lineNumber++;
+
+			std::istringstream ls(line);
+			std::string input, output, extra;
+
+			if(!(ls >> input) || input[0] == '#')
+			{
+				continue;
+			}
+
+			if(!(ls >> output) || (ls >> extra))
+			{
+				throw std::runtime_error("Malformed line in manifest '" + p.string() + "':" + std::to_string(lineNumber)
+						+ " (expected an input and an output file name)");
+			}
+
+			jobs.push_back({base / input, base / output});
+		}
+	}
+
+	template<class Host>
+	void add(Host* h)
+	{
+		GeneratorOptions::add(h);
+
+		h->addOptions({"-i", "--input"}, "Add input file, must be followed by the output file it is to be generated into", [this](const FilePath &p)
+		{
+			this->addInput(p);
+		});
+
+		h->addOptions({"-o", "--output"}, "Set the output file for the preceding input", [this](const FilePath &p)
+		{
+			this->addOutput(p);
+		});
+
+		h->addOptions({"-m", "--manifest"}, "Read input/output file pairs from a manifest file (one pair per line)", [this](const FilePath &p)
+		{
+			this->readManifest(p);
+		});
+
+		h->addOptions({"-j", "--jobs"}, "Set number of worker threads [default: number of processors]", [this](int n)
+		{
+			if(0 < n)
+			{
+				this->workers = n;
+			}
+			else
+			{
+				throw std::runtime_error("Invalid number of worker threads");
+			}
+		});
+	}
+
+	void run(const Job& job) const
+	{
+		std::ifstream input(job.input, std::ios::binary);
+
+		if(!input)
+		{
+			throw std::runtime_error("Input file could not be opened");
+		}
+
+		const auto entry = ContractCache::load(input);
+		const auto src = invokeGenerator(entry->ast, job.output.filename().string(), job.output);
+
+		std::ofstream output(job.output, std::ios::binary);
+
+		if(!(output << src))
+		{
+			throw std::runtime_error("Output file '" + job.output.string() + "' could not be written");
+		}
+
+		writeInstantiationUnit(entry->ast, job.output);
+	}
+};
+
+CLI_APP(batch, "Generate source code from many contract descriptors in a single run")
+{
+	BatchOptions opts;
+	opts.add(this);
+
+	if(this->processCommandLine())
+	{
+		if(opts.pendingInput)
+		{
+			throw std::runtime_error("No output file specified for input '" + opts.pendingInput->string() + "'");
+		}
+
+		// It would be the same for every job, each output is named after its own file instead.
+		if(opts.name)
+		{
+			throw std::runtime_error("The module name can not be set for a batch");
+		}
+
+		std::mutex errorLock;
+		std::atomic<size_t> next = 0, failed = 0;
+
+		auto worker = [&opts, &next, &failed, &errorLock]()
+		{
+			for(size_t idx; (idx = next++) < opts.jobs.size();)
+			{
+				const auto &job = opts.jobs[idx];
+
+				try
+				{
+					opts.run(job);
+				}
+				catch(const std::exception& e)
+				{
+					std::lock_guard _(errorLock);
+					std::cerr << job.input.string() << ": " << e.what() << std::endl;
+					failed++;
+				}
+			}
+		};
+
+		std::vector<std::thread> pool;
+		const auto n = std::min<size_t>(opts.workers, opts.jobs.size());
+
+		for(auto i = 1u; i < n; i++)
+		{
+			pool.emplace_back(worker);
+		}
+
+		worker();
+
+		for(auto &t: pool)
+		{
+			t.join();
+		}
+
+		return failed ? -1 : 0;
+	}
+
+	return -1;
+}
@@ -1,4 +1,4 @@
-#include "ast/ContractParser.h"
+#include "ast/ContractCache.h"
 #include "gen/Generator.h"
 
 #include "InputOptions.h"
@@ -17,9 +17,20 @@ CLI_APP(codegen, "Generate source code from contract descriptor")
 
 	if(this->processCommandLine())
 	{
-		const auto ast = parse(*opts.input);
-		const auto src = opts.invokeGenerator(ast, opts.OutputOptions::name);
+		if(opts.explicitInstantiation && !opts.path)
+		{
+			throw std::runtime_error("Explicit instantiation requires an output file to place the instantiation unit next to");
+		}
+
+		const auto entry = ContractCache::load(*opts.input);
+		const auto src = opts.invokeGenerator(entry->ast, opts.OutputOptions::name, opts.path);
 		*opts.output << src;
+
+		if(opts.explicitInstantiation)
+		{
+			opts.writeInstantiationUnit(entry->ast, *opts.path);
+		}
+
 		return 0;
 	}
 
@@ -1,4 +1,4 @@
-#include "ast/ContractParser.h"
+#include "ast/ContractCache.h"
 #include "ast/ContractFormatter.h"
 
 #include "InputOptions.h"
@@ -29,7 +29,7 @@ CLI_APP(dump, "Dump descriptor in textual format")
 		   opts.colored = false;
 		}
 
-		*opts.output << format(opts, parse(*opts.input));
+		*opts.output << format(opts, ContractCache::load(*opts.input)->ast);
 		return 0;
 	}
 
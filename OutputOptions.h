@@ -16,6 +16,7 @@ class OutputOptions
 public:
 	std::ostream *output = &std::cout;
 	std::optional<std::string> name;
+	std::optional<std::filesystem::path> path;
 
 	template<class Host>
 	void add(Host* h)
@@ -29,6 +30,7 @@ public:
 			else
 			{
 				this->output = &outputFile;
+				this->path = p;
 				this->name = basename(const_cast<char*>(p.string().c_str()));
 			}
 		});
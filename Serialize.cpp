@@ -1,12 +1,9 @@
-#include "ast/ContractParser.h"
-#include "ast/ContractTextCodec.h"
+#include "ast/ContractCache.h"
 
 #include "InputOptions.h"
 #include "OutputOptions.h"
 #include "CliApp.h"
 
-#include <sstream>
-
 struct SerializeOptions: InputOptions, OutputOptions {};
 
 CLI_APP(serialize, "Convert descriptor to dense binary format")
@@ -18,24 +15,7 @@ CLI_APP(serialize, "Convert descriptor to dense binary format")
 
 	if(this->processCommandLine())
 	{
-		auto ast = parse(*opts.input);
-		auto data = serializeText(ast);
-
-		std::istringstream is(data, std::ios::binary | std::ios::in);
-		auto rec = deserializeText(is);
-
-		auto it = rec.begin();
-		for(const auto& c: ast)
-		{
-			if(c.items.size())
-			{
-				assert(it != rec.end() && c == *it++);
-			}
-		}
-
-		assert(it == rec.end());
-
-		*opts.output << data;
+		*opts.output << ContractCache::load(*opts.input)->serialized();
 		return 0;
 	}
 
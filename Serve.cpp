@@ -0,0 +1,347 @@
+#include "Serve.h"
+
+#include "ast/ContractCache.h"
+
+#include "CliApp.h"
+
+#include <string>
+#include <vector>
+#include <sstream>
+#include <algorithm>
+#include <iostream>
+#include <iterator>
+#include <filesystem>
+#include <mutex>
+#include <thread>
+
+#include <cstdint>
+#include <cstring>
+
+#include <unistd.h>
+#include <sys/un.h>
+#include <sys/time.h>
+#include <sys/socket.h>
+
+/*
+ * Requests and responses are sequences of length prefixed frames.
+ *
+ * A request consists of the working directory of the client, the command line
+ * arguments (NUL separated) and the content of the standard input of the client
+ * (if the invoked sub-app takes its input from there and no input file is specified
+ * on the command line).
+ *
+ * The response carries the exit status, the standard output and the standard
+ * error of the invocation.
+ */
+namespace
+{
+	/// Time after which a stalled client is dropped, so that it can not hold up the server indefinitely.
+	static constexpr time_t clientTimeoutSeconds = 30;
+
+	/// Upper limit of the length of a frame, so that a bogus length prefix can not exhaust the memory of the server.
+	static constexpr uint32_t maxFrameLength = 64 << 20;
+
+	/// The sub-apps that read the descriptor from the standard input (unless given an input file).
+	static constexpr const char* standardInputApps[] = {"codegen", "dump", "serialize"};
+
+	bool sendAll(int fd, const char* data, size_t length)
+	{
+		while(length)
+		{
+			// The peer going away is reported as an error instead of raising SIGPIPE.
+			const auto r = send(fd, data, length, MSG_NOSIGNAL);
+
+			if(r <= 0)
+			{
+				return false;
+			}
+
+			data += r;
+			length -= r;
+		}
+
+		return true;
+	}
+
+	bool receiveAll(int fd, char* data, size_t length)
+	{
+		while(length)
+		{
+			const auto r = read(fd, data, length);
+
+			if(r <= 0)
+			{
+				return false;
+			}
+
+			data += r;
+			length -= r;
+		}
+
+		return true;
+	}
+
+	bool sendFrame(int fd, const std::string& str)
+	{
+		const uint32_t length = str.length();
+		return sendAll(fd, (const char*)&length, sizeof(length)) && sendAll(fd, str.data(), length);
+	}
+
+	bool receiveFrame(int fd, std::string& str)
+	{
+		uint32_t length;
+
+		if(!receiveAll(fd, (char*)&length, sizeof(length)) || maxFrameLength < length)
+		{
+			return false;
+		}
+
+		str.resize(length);
+		return receiveAll(fd, str.data(), length);
+	}
+
+	sockaddr_un socketAddress(const std::string& path)
+	{
+		sockaddr_un ret{};
+		ret.sun_family = AF_UNIX;
+
+		if(path.length() >= sizeof(ret.sun_path))
+		{
+			throw std::runtime_error("Socket path '" + path + "' is too long");
+		}
+
+		std::strcpy(ret.sun_path, path.c_str());
+		return ret;
+	}
+
+	bool readsStandardInput(int argc, const char* argv[])
+	{
+		if(argc < 2 || std::none_of(std::begin(standardInputApps), std::end(standardInputApps), [app{argv[1]}](const char* n){ return !std::strcmp(n, app); }))
+		{
+			return false;
+		}
+
+		for(int i = 2; i < argc; i++)
+		{
+			if(!std::strcmp(argv[i], "-i") || !std::strcmp(argv[i], "--input"))
+			{
+				return false;
+			}
+		}
+
+		return !isatty(STDIN_FILENO);
+	}
+
+	/// The invocations redirect the standard streams and change the working directory of the whole process, so they take turns.
+	std::mutex invocationLock;
+
+	class Redirect
+	{
+		std::ios &s;
+		std::streambuf* const saved;
+
+	public:
+		inline Redirect(std::ios &s, std::streambuf* b): s(s), saved(s.rdbuf(b)) {}
+		inline ~Redirect() { s.rdbuf(saved); }
+	};
+
+	void serve(int fd)
+	{
+		std::string cwd, args, input;
+
+		if(!receiveFrame(fd, cwd) || !receiveFrame(fd, args) || !receiveFrame(fd, input))
+		{
+			return;
+		}
+
+		std::vector<const char*> argv;
+		for(size_t idx = 0; idx < args.length(); idx += strlen(args.c_str() + idx) + 1)
+		{
+			argv.push_back(args.c_str() + idx);
+		}
+
+		std::istringstream in(input, std::ios::binary | std::ios::in);
+		std::ostringstream out(std::ios::binary | std::ios::out), err;
+		int status = -1;
+
+		if(argv.size() > 1 && !std::strcmp(argv[1], "serve"))
+		{
+			err << "Can not start server from within the server" << std::endl;
+		}
+		else
+		{
+			std::lock_guard<std::mutex> lock(invocationLock);
+			const auto savedCwd = std::filesystem::current_path();
+			Redirect ri(std::cin, in.rdbuf()), ro(std::cout, out.rdbuf()), re(std::cerr, err.rdbuf());
+
+			try
+			{
+				std::filesystem::current_path(cwd);
+				status = CliApp::main(argv.size(), argv.data());
+			}
+			catch(const std::exception& e)
+			{
+				std::cerr << e.what() << std::endl;
+			}
+
+			std::cout.flush();
+			std::cerr.flush();
+			std::filesystem::current_path(savedCwd);
+		}
+
+		sendFrame(fd, std::to_string(status)) && sendFrame(fd, out.str()) && sendFrame(fd, err.str());
+	}
+
+	/// Serves a connection on its own, so that a slow client only holds up itself.
+	void handle(int fd)
+	{
+		const timeval timeout{clientTimeoutSeconds, 0};
+		setsockopt(fd, SOL_SOCKET, SO_RCVTIMEO, &timeout, sizeof(timeout));
+		setsockopt(fd, SOL_SOCKET, SO_SNDTIMEO, &timeout, sizeof(timeout));
+
+		// Whatever goes wrong with a request only ends its connection, not the server.
+		try
+		{
+			serve(fd);
+		}
+		catch(const std::exception& e)
+		{
+			std::lock_guard<std::mutex> lock(invocationLock);
+			std::cerr << "Request failed: " << e.what() << std::endl;
+		}
+
+		close(fd);
+	}
+}
+
+std::optional<int> forwardToServer(const char* socketPath, int argc, const char* argv[])
+{
+	const auto addr = socketAddress(socketPath);
+
+	std::string args;
+	for(int i = 0; i < argc; i++)
+	{
+		args.append(argv[i], strlen(argv[i]) + 1);
+	}
+
+	// Read before connecting, so that the server does not wait for the producer of the input.
+	std::string input;
+	const bool piped = readsStandardInput(argc, argv);
+	if(piped)
+	{
+		input.assign(std::istreambuf_iterator<char>(std::cin), std::istreambuf_iterator<char>());
+	}
+
+	const int fd = socket(AF_UNIX, SOCK_STREAM, 0);
+
+	if(fd < 0 || connect(fd, (const sockaddr*)&addr, sizeof(addr)) != 0)
+	{
+		if(fd >= 0)
+		{
+			close(fd);
+		}
+
+		// The input is consumed already, so it is handed over to the local invocation.
+		if(piped)
+		{
+			static std::istringstream consumed;
+			consumed.str(input);
+			std::cin.rdbuf(consumed.rdbuf());
+		}
+
+		return {};
+	}
+
+	std::string status, out, err;
+	const bool ok = sendFrame(fd, std::filesystem::current_path().string())
+			&& sendFrame(fd, args)
+			&& sendFrame(fd, input)
+			&& receiveFrame(fd, status)
+			&& receiveFrame(fd, out)
+			&& receiveFrame(fd, err);
+
+	close(fd);
+
+	if(!ok)
+	{
+		throw std::runtime_error("Connection to server at '" + std::string(socketPath) + "' failed");
+	}
+
+	std::cout << out << std::flush;
+	std::cerr << err << std::flush;
+	return std::stoi(status);
+}
+
+struct ServeOptions
+{
+	std::optional<std::string> socketPath;
+	size_t cacheCapacity = 256;
+
+	template<class Host>
+	void add(Host* h)
+	{
+		if(const char* s = getenv(serverSocketVariable))
+		{
+			socketPath = s;
+		}
+
+		h->addOptions({"-S", "--socket"}, "Set the path of the socket to listen on [default: taken from the ROLL_CONTRACT_TOOL_SOCKET environment variable]", [this](const std::string &str)
+		{
+			this->socketPath = str;
+		});
+
+		h->addOption("--cache-size", "Set the maximal number of parsed descriptors kept in memory [default: 256]", [this](int n)
+		{
+			if(0 <= n)
+			{
+				this->cacheCapacity = n;
+			}
+			else
+			{
+				throw std::runtime_error("Invalid cache size");
+			}
+		});
+	}
+};
+
+CLI_APP(serve, "Keep serving requests over a unix domain socket (for invocations with ROLL_CONTRACT_TOOL_SOCKET set)")
+{
+	ServeOptions opts;
+	opts.add(this);
+
+	if(this->processCommandLine())
+	{
+		if(!opts.socketPath)
+		{
+			throw std::runtime_error("No socket path specified");
+		}
+
+		ContractCache::setCapacity(opts.cacheCapacity);
+
+		const auto addr = socketAddress(*opts.socketPath);
+		const int fd = socket(AF_UNIX, SOCK_STREAM, 0);
+		unlink(opts.socketPath->c_str());
+
+		if(fd < 0 || bind(fd, (const sockaddr*)&addr, sizeof(addr)) != 0 || listen(fd, SOMAXCONN) != 0)
+		{
+			throw std::runtime_error("Could not listen on socket '" + *opts.socketPath + "': " + strerror(errno));
+		}
+
+		while(true)
+		{
+			if(const int conn = accept(fd, nullptr, nullptr); conn >= 0)
+			{
+				try
+				{
+					std::thread(handle, conn).detach();
+				}
+				catch(const std::system_error&)
+				{
+					close(conn);
+				}
+			}
+		}
+	}
+
+	return -1;
+}
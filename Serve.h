@@ -0,0 +1,18 @@
+#ifndef RPC_TOOL_SERVE_H_
+#define RPC_TOOL_SERVE_H_
+
+#include <optional>
+
+/// Name of the environment variable that makes the tool forward its invocation to a running server.
+static constexpr const char* serverSocketVariable = "ROLL_CONTRACT_TOOL_SOCKET";
+
+/*
+ * Forwards the command line to the server listening on the specified socket and
+ * relays the output and exit status of the remote invocation.
+ *
+ * Returns nothing if the server could not be reached, so that the caller can
+ * fall back to processing the request locally.
+ */
+std::optional<int> forwardToServer(const char* socketPath, int argc, const char* argv[]);
+
+#endif /* RPC_TOOL_SERVE_H_ */
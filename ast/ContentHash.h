@@ -0,0 +1,18 @@
+#ifndef RPC_TOOL_AST_CONTENTHASH_H_
+#define RPC_TOOL_AST_CONTENTHASH_H_
+
+#include <string_view>
+#include <cstdint>
+
+/// 64-bit FNV-1a hash, used as key for caching data derived from contract descriptors.
+static constexpr inline uint64_t contentHash(std::string_view str, uint64_t h = 0xcbf29ce484222325ull)
+{
+	for(const auto c: str)
+	{
+		h = (h ^ (uint8_t)c) * 0x100000001b3ull;
+	}
+
+	return h;
+}
+
+#endif /* RPC_TOOL_AST_CONTENTHASH_H_ */
@@ -6,22 +6,53 @@
 #include <memory>
 #include <variant>
 #include <optional>
+#include <algorithm>
 #include <stdexcept>
 
 struct Contract
 {
-	struct Collection; 	//< Variably sized array (like std::vector).
+	struct Collection; 	//< Variably sized array (like std::vector), optionally with a maximum number of elements.
+	struct Array; 		//< Fixed number of elements (like std::array).
 	struct Aggregate; 	//< Structured data (like a struct)
 	struct Var; 		//< A named slot for a value of a predetermined type.
+	struct Annotation; 	//< Opt-in switch that changes how the generators treat the annotated element.
 
-	/// Single 1/2/4/8 byte signed/unsigned word (primitive integers).
+	/// Single 1/2/4/8 byte signed/unsigned word (primitive integers) or a length prefixed UTF-8 string.
 	enum class Primitive
 	{
-		Bool, I1, U1, I2, U2, I4, U4, I8, U8
+		Bool, I1, U1, I2, U2, I4, U4, I8, U8, String
 	};
 
-	using TypeRef = std::variant<Primitive, Collection, std::string>;
-	using TypeDef = std::variant<Primitive, Collection, Aggregate, std::string>;
+	using TypeRef = std::variant<Primitive, Collection, std::string, Array>;
+	using TypeDef = std::variant<Primitive, Collection, Aggregate, std::string, Array>;
+
+	/// A %name or %name(N) marker after the declaration of a contract, type alias, call or variable (like %bitflags).
+	struct Annotation
+	{
+		const std::string name;
+		const std::optional<size_t> value = {};
+
+		inline bool operator==(const Annotation& o) const {
+			return name == o.name && value == o.value;
+		}
+	};
+
+	static inline const Annotation* findAnnotation(const std::vector<Annotation>& as, const std::string& n)
+	{
+		const auto it = std::find_if(as.begin(), as.end(), [&n](const auto& a){ return a.name == n; });
+		return (it != as.end()) ? &*it : nullptr;
+	}
+
+	static inline bool isAnnotated(const std::vector<Annotation>& as, const std::string& n) {
+		return findAnnotation(as, n) != nullptr;
+	}
+
+	/// The argument of the annotation, if present and has one.
+	static inline std::optional<size_t> annotationValue(const std::vector<Annotation>& as, const std::string& n)
+	{
+		const auto a = findAnnotation(as, n);
+		return a ? a->value : std::nullopt;
+	}
 
 	/// Zero or more elements of the same type (dynamic array).
 	struct Aggregate
@@ -37,9 +68,21 @@ struct Contract
 	struct Collection
 	{
 		const std::shared_ptr<TypeRef> elementType;
+		const std::optional<size_t> capacity = {};
 
 		inline bool operator==(const Collection& o) const {
-			return *elementType == *o.elementType;
+			return *elementType == *o.elementType && capacity == o.capacity;
+		}
+	};
+
+	/// A fixed number of elements of the same type (static array), no length is sent on the wire.
+	struct Array
+	{
+		const std::shared_ptr<TypeRef> elementType;
+		const size_t length;
+
+		inline bool operator==(const Array& o) const {
+			return *elementType == *o.elementType && length == o.length;
 		}
 	};
 
@@ -49,11 +92,13 @@ struct Contract
 		const std::string name;
 		const TypeRef type;
 		const std::string docs;
+		const std::vector<Annotation> annotations;
 
-		inline Var(const std::string &name, TypeRef type, std::string docs): name(name), type(type), docs(docs) {}
+		inline Var(const std::string &name, TypeRef type, std::string docs, std::vector<Annotation> annotations = {}):
+			name(name), type(type), docs(docs), annotations(annotations) {}
 
 		inline bool operator==(const Var& o) const {
-			return name == o.name && type == o.type;
+			return name == o.name && type == o.type && annotations == o.annotations;
 		}
 	};
 
@@ -61,9 +106,14 @@ struct Contract
 	{
 		const std::string name;
 		const std::vector<Var> args;
+		const std::vector<Annotation> annotations = {};
 
 		inline bool operator==(const Action& o) const {
-			return name == o.name && args == o.args;
+			return name == o.name && args == o.args && annotations == o.annotations;
+		}
+
+		inline bool isAnnotated(const std::string& n) const {
+			return Contract::isAnnotated(annotations, n);
 		}
 	};
 
@@ -81,10 +131,11 @@ struct Contract
 	{
 		const TypeDef type;
 		const std::string name;
-		inline Alias(const std::string &name, TypeDef type): type(type), name(name) {}
+		const std::vector<Annotation> annotations;
+		inline Alias(const std::string &name, TypeDef type, std::vector<Annotation> annotations = {}): type(type), name(name), annotations(annotations) {}
 
 		inline bool operator==(const Alias& o) const {
-			return type == o.type && name == o.name;
+			return type == o.type && name == o.name && annotations == o.annotations;
 		}
 	};
 
@@ -107,9 +158,14 @@ struct Contract
 	using Item = std::pair<std::string, std::variant<Function, Alias, Session>>;
 	const std::vector<Item> items;
 	const std::string name, docs;
+	const std::vector<Annotation> annotations = {};
 
 	inline bool operator==(const Contract& o) const {
-		return items == o.items;
+		return items == o.items && annotations == o.annotations;
+	}
+
+	inline bool isAnnotated(const std::string& n) const {
+		return isAnnotated(annotations, n);
 	}
 
 	static inline std::string mapPrimitive(Contract::Primitive p)
@@ -125,6 +181,7 @@ struct Contract
 		case Contract::Primitive::U4: return "u4";
 		case Contract::Primitive::I8: return "i8";
 		case Contract::Primitive::U8: return "u8";
+		case Contract::Primitive::String: return "string";
 		default: throw std::runtime_error("unknown primitive type: " + std::to_string((int)p));
 		}
 	}
@@ -0,0 +1,98 @@
+#include "ContractCache.h"
+#include "ContractParser.h"
+#include "ContractTextCodec.h"
+#include "ContentHash.h"
+
+#include <map>
+#include <list>
+#include <sstream>
+#include <iterator>
+
+#include <cassert>
+
+namespace
+{
+	std::mutex lock;
+	size_t capacity = 0;
+
+	std::map<uint64_t, std::shared_ptr<const ContractCache::Entry>> entries;
+	std::list<uint64_t> insertionOrder;
+}
+
+const std::string& ContractCache::Entry::serialized() const
+{
+	std::call_once(serializeOnce, [this]()
+	{
+		serializedText = serializeText(ast);
+
+		std::istringstream is(serializedText, std::ios::binary | std::ios::in);
+		auto rec = deserializeText(is);
+
+		auto it = rec.begin();
+		for(const auto& c: ast)
+		{
+			if(c.items.size())
+			{
+				assert(it != rec.end() && c == *it++);
+			}
+		}
+
+		assert(it == rec.end());
+	});
+
+	return serializedText;
+}
+
+std::shared_ptr<const ContractCache::Entry> ContractCache::load(std::istream& is)
+{
+	std::string content{std::istreambuf_iterator<char>(is), std::istreambuf_iterator<char>()};
+	const auto key = contentHash(content);
+
+	{
+		std::lock_guard _(lock);
+
+		if(auto it = entries.find(key); it != entries.end() && it->second->content == content)
+		{
+			return it->second;
+		}
+	}
+
+	std::istringstream ss(content, std::ios::binary | std::ios::in);
+	auto ast = parse(ss);
+	auto ret = std::make_shared<const Entry>(std::move(content), std::move(ast));
+
+	std::lock_guard _(lock);
+
+	if(capacity)
+	{
+		if(auto it = entries.find(key); it != entries.end())
+		{
+			it->second = ret;
+		}
+		else
+		{
+			while(entries.size() >= capacity)
+			{
+				entries.erase(insertionOrder.front());
+				insertionOrder.pop_front();
+			}
+
+			entries.emplace(key, ret);
+			insertionOrder.push_back(key);
+		}
+	}
+
+	return ret;
+}
+
+void ContractCache::setCapacity(size_t n)
+{
+	std::lock_guard _(lock);
+	capacity = n;
+
+	while(entries.size() > capacity)
+	{
+		entries.erase(insertionOrder.front());
+		insertionOrder.pop_front();
+	}
+}
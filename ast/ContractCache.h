@@ -0,0 +1,40 @@
+#ifndef RPC_TOOL_AST_CONTRACTCACHE_H_
+#define RPC_TOOL_AST_CONTRACTCACHE_H_
+
+#include "Contract.h"
+
+#include <iosfwd>
+#include <mutex>
+
+/*
+ * Memoizes the parsed and serialized forms of contract descriptors keyed by
+ * the hash of their content, so that a long running process does not need to
+ * go through the parser again for inputs that did not change.
+ *
+ * The cache is disabled (has zero capacity) by default, in which case every
+ * load results in a freshly parsed entry.
+ */
+class ContractCache
+{
+public:
+	class Entry
+	{
+		friend ContractCache;
+
+		mutable std::once_flag serializeOnce;
+		mutable std::string serializedText;
+
+	public:
+		const std::string content;
+		const std::vector<Contract> ast;
+
+		inline Entry(std::string content, std::vector<Contract> ast): content(std::move(content)), ast(std::move(ast)) {}
+
+		const std::string& serialized() const;
+	};
+
+	static std::shared_ptr<const Entry> load(std::istream& is);
+	static void setCapacity(size_t n);
+};
+
+#endif /* RPC_TOOL_AST_CONTRACTCACHE_H_ */
@@ -141,8 +141,15 @@ static inline std::string formatComment(const FormatOptions& opts, const int n,
 	return ss.str();
 }
 
+static inline std::string annotations(const std::vector<Contract::Annotation>& as)
+{
+	return std::accumulate(as.begin(), as.end(), std::string{}, [](const std::string& a, const auto& i){
+		return a + " %" + i.name + (i.value ? "(" + std::to_string(*i.value) + ")" : std::string{});
+	});
+}
+
 static inline std::string memberItem(const FormatOptions& opts, const int n, const Contract::Var &v, FormatOptions::Highlight h, bool first) {
-	return formatComment(opts, n, v.docs, first) + opts.colorize(v.name, h) + ": "  + typeRef(opts, n, v.type);
+	return formatComment(opts, n, v.docs, first) + opts.colorize(v.name, h) + ": "  + typeRef(opts, n, v.type) + annotations(v.annotations);
 }
 
 template<class C, class F>
@@ -180,8 +187,14 @@ static inline std::string typeRefKindToString(const FormatOptions& opts, const i
 	return opts.colorize(Contract::mapPrimitive(p), FormatOptions::Highlight::Primitive);
 }
 
-static inline std::string typeRefKindToString(const FormatOptions& opts, const int n, const Contract::Collection& c) {
-	return opts.formatNewlineIndentDelimit(n, typeRef(opts, n + 1, *c.elementType), '[', ']');
+static inline std::string typeRefKindToString(const FormatOptions& opts, const int n, const Contract::Collection& c)
+{
+	const auto bound = c.capacity ? ("; <=" + std::to_string(*c.capacity)) : std::string{};
+	return opts.formatNewlineIndentDelimit(n, typeRef(opts, n + 1, *c.elementType) + bound, '[', ']');
+}
+
+static inline std::string typeRefKindToString(const FormatOptions& opts, const int n, const Contract::Array& a) {
+	return opts.formatNewlineIndentDelimit(n, typeRef(opts, n + 1, *a.elementType) + "; " + std::to_string(a.length), '[', ']');
 }
 
 static inline std::string typeRefKindToString(const FormatOptions& opts, const int n, const std::string& p) {
@@ -225,30 +238,31 @@ static inline std::string signature(const FormatOptions& opts, const int n, cons
 }
 
 static inline std::string formatItem(const FormatOptions& opts, const int n, const Contract::Action& s) {
-	return opts.indent(n) + signature(opts, n, s) + ";";
+	return opts.indent(n) + signature(opts, n, s) + annotations(s.annotations) + ";";
 }
 
-static inline std::string formatItem(const FormatOptions& opts, const int n, const Contract::Function& s)
-{
-	return opts.indent(n)
-		+ signature(opts, n, s)
-		+ ((s.returnType.has_value()) ? (std::string(": ") + typeRef(opts, n + 1, s.returnType.value())) : std::string{}) + ";";
+static inline std::string returnType(const FormatOptions& opts, const int n, const Contract::Function& s) {
+	return (s.returnType.has_value()) ? (std::string(": ") + typeRef(opts, n + 1, s.returnType.value())) : std::string{};
+}
+
+static inline std::string formatItem(const FormatOptions& opts, const int n, const Contract::Function& s) {
+	return opts.indent(n) + signature(opts, n, s) + returnType(opts, n, s) + annotations(s.annotations) + ";";
 }
 
 static inline std::string formatItem(const FormatOptions& opts, const int n, const Contract::Alias& s) {
-	return opts.indent(n) + opts.colorize(s.name, FormatOptions::Highlight::TypeDef) + " = " + typeDef(opts, n, s.type) + ";";
+	return opts.indent(n) + opts.colorize(s.name, FormatOptions::Highlight::TypeDef) + " = " + typeDef(opts, n, s.type) + annotations(s.annotations) + ";";
 }
 
 static inline std::string formatSessionItem(const FormatOptions& opts, const int n, const Contract::Session::ForwardCall& s) {
-	return "!" + signature(opts, n, s);
+	return "!" + signature(opts, n, s) + annotations(s.annotations);
 }
 
 static inline std::string formatSessionItem(const FormatOptions& opts, const int n, const Contract::Session::CallBack& s) {
-	return "@" + signature(opts, n, s);
+	return "@" + signature(opts, n, s) + annotations(s.annotations);
 }
 
 static inline std::string formatSessionItem(const FormatOptions& opts, const int n, const Contract::Session::Ctor& s) {
-	return signature(opts, n, s);
+	return signature(opts, n, s) + returnType(opts, n, s) + annotations(s.annotations);
 }
 
 static inline std::string formatItem(const FormatOptions& opts, const int n, const Contract::Session& s)
@@ -270,7 +284,7 @@ std::string format(const FormatOptions& opts, const std::vector<Contract>& ast)
 
 	for(const auto& c: ast)
 	{
-		ss << formatComment(opts, 0, c.docs, true) << "$" << c.name << ";" << std::endl;
+		ss << formatComment(opts, 0, c.docs, true) << "$" << c.name << annotations(c.annotations) << ";" << std::endl;
 
 		std::transform(c.items.begin(), c.items.end(), std::ostream_iterator<std::string>(ss, "\n"), [&opts](const auto& s)
 		{
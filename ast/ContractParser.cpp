@@ -7,6 +7,7 @@
 #include "rpcLexer.h"
 
 #include <map>
+#include <set>
 #include <algorithm>
 #include <cassert>
 
@@ -20,6 +21,81 @@ static inline std::string validateName(const std::string& str)
 	return str;
 }
 
+/// Annotations understood by the generators, on the declaration of the contract.
+static const std::set<std::string> contractAnnotations = {
+	"bitflags",
+	"varint",
+};
+
+/// Annotations understood by the generators, on type aliases.
+static const std::set<std::string> aliasAnnotations = {
+	"varint",
+	"bulk",
+	"maxsize",
+};
+
+/// Usage hints on functions and session items, that the generators may pick cheaper code paths by.
+static const std::set<std::string> callAnnotations = {
+	"idempotent",
+	"hot",
+	"batchable",
+	"maxsize",
+};
+
+/// Usage hints on arguments and aggregate members.
+static const std::set<std::string> varAnnotations = {
+	"bulk",
+	"maxsize",
+};
+
+/// Annotations that take a numeric argument, like %maxsize(4096).
+static const std::set<std::string> valuedAnnotations = {
+	"maxsize",
+};
+
+/// Position of the construct in the source, in the same format as the syntax errors are reported in.
+static inline std::string location(antlr4::ParserRuleContext* ctx) {
+	return "line " + std::to_string(ctx->getStart()->getLine()) + ":" + std::to_string(ctx->getStart()->getCharPositionInLine());
+}
+
+static inline Contract::Annotation validateAnnotation(const std::set<std::string>& known, rpcParser::AnnotationContext* ctx)
+{
+	const auto str = ctx->name->getText();
+
+	if(known.find(str) == known.end())
+	{
+		throw std::runtime_error(location(ctx) + " Unknown annotation '%" + str + "'");
+	}
+
+	const bool valued = valuedAnnotations.find(str) != valuedAnnotations.end();
+
+	if(valued != (ctx->value != nullptr))
+	{
+		throw std::runtime_error(location(ctx) + " Annotation '%" + str + "' " + (valued ? "requires a numeric argument" : "takes no argument"));
+	}
+
+	return {str, valued ? std::optional<size_t>(std::stoul(ctx->value->getText())) : std::nullopt};
+}
+
+static inline std::vector<Contract::Annotation> makeAnnotations(const std::set<std::string>& known, const std::vector<rpcParser::AnnotationContext*>& as)
+{
+	std::vector<Contract::Annotation> ret;
+
+	for(auto a: as)
+	{
+		auto v = validateAnnotation(known, a);
+
+		if(Contract::isAnnotated(ret, v.name))
+		{
+			throw std::runtime_error(location(a) + " Duplicate annotation '%" + v.name + "'");
+		}
+
+		ret.push_back(std::move(v));
+	}
+
+	return ret;
+}
+
 struct SemanticParser
 {
 	std::map<std::string, Contract::TypeDef> aliases;
@@ -127,7 +203,7 @@ struct SemanticParser
 	}
 
 	inline Contract::Var makeVar(rpcParser::VarContext* ctx) const {
-		return { validateName(ctx->name->getText()), resolveTypeRef(ctx->t), makeDocs(ctx->docs)};
+		return { validateName(ctx->name->getText()), resolveTypeRef(ctx->t), makeDocs(ctx->docs), makeAnnotations(varAnnotations, ctx->annotations)};
 	}
 
 	template<class It> std::vector<Contract::Var> parseVarList(It begin, It end) const
@@ -137,19 +213,19 @@ struct SemanticParser
 		return ret;
 	}
 
-	inline Contract::Action makeCall(rpcParser::ActionContext* ctx) const {
-		return {validateName(ctx->name->getText()), parseVarList(ctx->args->vars.begin(), ctx->args->vars.end())};
+	inline Contract::Action makeCall(rpcParser::ActionContext* ctx, const std::vector<rpcParser::AnnotationContext*>& as) const {
+		return {validateName(ctx->name->getText()), parseVarList(ctx->args->vars.begin(), ctx->args->vars.end()), makeAnnotations(callAnnotations, as)};
 	}
 
 	inline Contract::Function makeFunc(rpcParser::FunctionContext* ctx) const
 	{
 		if(ctx->ret)
 		{
-			return Contract::Function(makeCall(ctx->call), resolveTypeRef(ctx->ret));
+			return Contract::Function(makeCall(ctx->call, ctx->annotations), resolveTypeRef(ctx->ret));
 		}
 		else
 		{
-			return Contract::Function(makeCall(ctx->call), {});
+			return Contract::Function(makeCall(ctx->call, ctx->annotations), {});
 		}
 	}
 
@@ -160,11 +236,11 @@ struct SemanticParser
 		{
 			if(auto d = i->fwd)
 			{
-				return {makeDocs(i->docs), Contract::Session::ForwardCall(makeCall(d->sym))};
+				return {makeDocs(i->docs), Contract::Session::ForwardCall(makeCall(d->sym, d->annotations))};
 			}
 			else if(auto d = i->bwd)
 			{
-				return {makeDocs(i->docs), Contract::Session::CallBack(makeCall(d->sym))};
+				return {makeDocs(i->docs), Contract::Session::CallBack(makeCall(d->sym, d->annotations))};
 			}
 			else if(auto d = i->ctr)
 			{
@@ -181,6 +257,14 @@ struct SemanticParser
 		return Contract::Session{validateName(ctx->name->getText()), parseSession(ctx->items)};
 	}
 
+	/*
+	 * The string type is lexed as an identifier instead of being a keyword of the grammar, so that it is only
+	 * special in type position. Using it as a name is reported as such by the check of the forbidden names.
+	 */
+	static inline bool isStringTypeName(const std::string& name) {
+		return name == "string";
+	}
+
 	inline std::string checkAlias(const std::string& name) const
 	{
 		if(auto it = aliases.find(name); it == aliases.end())
@@ -191,6 +275,37 @@ struct SemanticParser
 		return name;
 	}
 
+	inline Contract::Collection makeCollection(rpcParser::CollectionContext* ctx) const
+	{
+		const auto elementType = std::make_shared<Contract::TypeRef>(resolveTypeRef(ctx->elementType));
+
+		if(ctx->capacity)
+		{
+			const auto capacity = std::stoul(ctx->capacity->getText());
+
+			if(!capacity)
+			{
+				throw std::runtime_error("Collection capacity must be positive");
+			}
+
+			return Contract::Collection{elementType, capacity};
+		}
+
+		return Contract::Collection{elementType};
+	}
+
+	inline Contract::Array makeArray(rpcParser::ArrayContext* ctx) const
+	{
+		const auto length = std::stoul(ctx->length->getText());
+
+		if(!length)
+		{
+			throw std::runtime_error("Array length must be positive");
+		}
+
+		return Contract::Array{std::make_shared<Contract::TypeRef>(resolveTypeRef(ctx->elementType)), length};
+	}
+
 	inline Contract::TypeRef resolveTypeRef(rpcParser::TyperefContext* ctx) const
 	{
 		if(auto data = ctx->p)
@@ -199,16 +314,61 @@ struct SemanticParser
 		}
 		else if(auto data = ctx->c)
 		{
-			return Contract::Collection{std::make_shared<Contract::TypeRef>(resolveTypeRef(data->elementType))};
+			return makeCollection(data);
+		}
+		else if(auto data = ctx->r)
+		{
+			return makeArray(data);
 		}
 		else if(auto data = ctx->n)
 		{
+			if(isStringTypeName(data->getText()))
+			{
+				return Contract::Primitive::String;
+			}
+
 			return checkAlias(data->getText());
 		}
 
 		throw std::runtime_error("Internal error: unknown type kind in reference");
 	}
 
+	/// Whether the type is (an alias of) a 4 or 8 byte integer.
+	inline bool isWideInteger(const Contract::TypeDef& t) const
+	{
+		if(auto p = std::get_if<Contract::Primitive>(&t))
+		{
+			switch(*p)
+			{
+			case Contract::Primitive::I4:
+			case Contract::Primitive::U4:
+			case Contract::Primitive::I8:
+			case Contract::Primitive::U8:
+				return true;
+			default:
+				return false;
+			}
+		}
+		else if(auto n = std::get_if<std::string>(&t))
+		{
+			return isWideInteger(aliases.at(*n));
+		}
+
+		return false;
+	}
+
+	inline std::vector<Contract::Annotation> makeAliasAnnotations(rpcParser::TypeAliasContext* ctx, const Contract::TypeDef& t) const
+	{
+		const auto ret = makeAnnotations(aliasAnnotations, ctx->annotations);
+
+		if(Contract::isAnnotated(ret, "varint") && !isWideInteger(t))
+		{
+			throw std::runtime_error("Annotation '%varint' is only applicable to 4 and 8 byte integers (on '" + ctx->name->getText() + "')");
+		}
+
+		return ret;
+	}
+
 	inline Contract::TypeDef addAlias(const std::string &name, Contract::TypeDef ret)
 	{
 		aliases.emplace(name, ret);
@@ -225,10 +385,19 @@ struct SemanticParser
 		}
 		else if(auto data = ctx->c)
 		{
-			return addAlias(name, Contract::Collection{std::make_shared<Contract::TypeRef>(resolveTypeRef(data->elementType))});
+			return addAlias(name, makeCollection(data));
+		}
+		else if(auto data = ctx->r)
+		{
+			return addAlias(name, makeArray(data));
 		}
 		else if(auto data = ctx->n)
 		{
+			if(isStringTypeName(data->getText()))
+			{
+				return addAlias(name, Contract::Primitive::String);
+			}
+
 			return addAlias(name, checkAlias(data->getText()));
 		}
 		else if(auto data = ctx->a)
@@ -247,7 +416,8 @@ struct SemanticParser
 		}
 		else if(auto d = s->alias)
 		{
-			return {makeDocs(s->docs), Contract::Alias{validateName(d->name->getText()), resolveTypeDef(d)}};
+			const auto t = resolveTypeDef(d);
+			return {makeDocs(s->docs), Contract::Alias{validateName(d->name->getText()), t, makeAliasAnnotations(d, t)}};
 		}
 		else if(auto d = s->sess)
 		{
@@ -275,6 +445,8 @@ public:
 			auto docs = makeDocs(contract->docs);
 			auto name = validateName(contract->cont->name->getText());
 
+			auto annotations = makeAnnotations(contractAnnotations, contract->cont->annotations);
+
 			SemanticParser sps;
 			std::vector<Contract::Item> items;
 
@@ -283,7 +455,7 @@ public:
 				items.push_back(sps.processItem(*it++));
 			}
 
-			ret.push_back({std::move(items), name, docs});
+			ret.push_back({std::move(items), name, docs, std::move(annotations)});
 		}
 
 		return ret;
@@ -13,11 +13,11 @@ struct ContractSerDes
 	};
 
 	enum class TypeRefSelector {
-		Primitive, Collection, Alias, None
+		Primitive, Collection, Alias, Array, Bounded, None
 	};
 
 	enum class TypeDefSelector {
-		Primitive, Collection, Aggregate, Alias
+		Primitive, Collection, Aggregate, Alias, Array, Bounded
 	};
 
 	enum class SessionItemSelector {
@@ -39,6 +39,7 @@ class ContractSerializer: public ContractSerDes
 			typeRef(i.type);
 			child()->writeIdentifier(i.name);
 			child()->writeText(i.docs);
+			annotations(i.annotations);
 		}
 
 		child()->write(TypeRefSelector::None);
@@ -52,8 +53,8 @@ class ContractSerializer: public ContractSerDes
 
 	inline void refKind(const Contract::Collection& a)
 	{
-		child()->write(TypeRefSelector::Collection);
-		typeRef(*a.elementType);
+		child()->write(a.capacity ? TypeRefSelector::Bounded : TypeRefSelector::Collection);
+		collection(a);
 	}
 
 	inline void refKind(const std::string& n)
@@ -62,10 +63,33 @@ class ContractSerializer: public ContractSerDes
 		child()->writeIdentifier(n);
 	}
 
+	inline void refKind(const Contract::Array& a)
+	{
+		child()->write(TypeRefSelector::Array);
+		array(a);
+	}
+
 	inline void typeRef(const Contract::TypeRef &t) {
 		std::visit([this](const auto& t){refKind(t);}, t);
 	}
 
+	/// Bounded collections have their own selector, so that the unbounded ones are written as before.
+	inline void collection(const Contract::Collection& a)
+	{
+		typeRef(*a.elementType);
+
+		if(a.capacity)
+		{
+			child()->writeIdentifier(std::to_string(*a.capacity));
+		}
+	}
+
+	inline void array(const Contract::Array& a)
+	{
+		typeRef(*a.elementType);
+		child()->writeIdentifier(std::to_string(a.length));
+	}
+
 	inline void retType(std::optional<Contract::TypeRef> t)
 	{
 		if(t.has_value())
@@ -86,8 +110,8 @@ class ContractSerializer: public ContractSerDes
 
 	inline void defKind(const Contract::Collection& a)
 	{
-		child()->write(TypeDefSelector::Collection);
-		typeRef(*a.elementType);
+		child()->write(a.capacity ? TypeDefSelector::Bounded : TypeDefSelector::Collection);
+		collection(a);
 	}
 
 	inline void defKind(const Contract::Aggregate& a)
@@ -102,6 +126,12 @@ class ContractSerializer: public ContractSerDes
 		child()->writeIdentifier(n);
 	}
 
+	inline void defKind(const Contract::Array& a)
+	{
+		child()->write(TypeDefSelector::Array);
+		array(a);
+	}
+
 	inline void typeDef(const Contract::TypeDef &t) {
 		std::visit([this](const auto& t){defKind(t);}, t);
 	}
@@ -113,6 +143,18 @@ class ContractSerializer: public ContractSerDes
 		child()->writeIdentifier(f.name);
 		retType(f.returnType);
 		varList(f.args);
+		annotations(f.annotations);
+	}
+
+	inline void annotations(const std::vector<Contract::Annotation>& as)
+	{
+		for(const auto& a: as)
+		{
+			child()->writeIdentifier(a.name);
+			child()->writeIdentifier(a.value ? std::to_string(*a.value) : std::string{});
+		}
+
+		child()->writeIdentifier({});
 	}
 
 	inline void processItem(const Contract::Alias& a)
@@ -120,6 +162,7 @@ class ContractSerializer: public ContractSerDes
 		child()->write(RootSelector::Type);
 		child()->writeIdentifier(a.name);
 		typeDef(a.type);
+		annotations(a.annotations);
 	}
 
 	template<auto start = RootSelector::Func>
@@ -128,6 +171,7 @@ class ContractSerializer: public ContractSerDes
 		child()->write(start);
 		child()->writeIdentifier(a.name);
 		varList(a.args);
+		annotations(a.annotations);
 	}
 
 	inline void processSessionItem(const Contract::Session::ForwardCall& a) {
@@ -175,6 +219,7 @@ public:
 			child()->write(RootSelector::None);
 			child()->writeIdentifier(c.name);
 			child()->writeText(c.docs);
+			annotations(c.annotations);
 		}
 
 		child()->write(RootSelector::None);
@@ -190,10 +235,25 @@ class ContractDeserializer: public ContractSerDes
 
 	std::map<std::string, Contract::TypeDef> aliases;
 
+	/// Kinds of types introduced by a later format version can not occur in data written before it.
+	void requireVersion(int since, const std::string& what)
+	{
+		if(!child()->hasVersion(since))
+		{
+			throw std::runtime_error("Invalid " + what + " found in data of an older format version");
+		}
+	}
+
 	Contract::Primitive primitive()
 	{
 		Contract::Primitive p;
 		child()->read(p);
+
+		if(p == Contract::Primitive::String)
+		{
+			requireVersion(5, "string type");
+		}
+
 		return p;
 	}
 
@@ -208,8 +268,12 @@ class ContractDeserializer: public ContractSerDes
 			return primitive();
 		case TypeRefSelector::Collection:
 			return collection();
+		case TypeRefSelector::Bounded:
+			return bounded();
 		case TypeRefSelector::Alias:
 			return aliasRef();
+		case TypeRefSelector::Array:
+			return array();
 		default:
 			return {};
 		}
@@ -227,6 +291,33 @@ class ContractDeserializer: public ContractSerDes
 		}
 	}
 
+	Contract::Collection bounded()
+	{
+		requireVersion(4, "bounded collection");
+
+		const auto c = collection();
+
+		std::string capacity;
+		child()->readIdentifier(capacity);
+		return Contract::Collection{c.elementType, std::stoul(capacity)};
+	}
+
+	Contract::Array array()
+	{
+		requireVersion(3, "array type");
+
+		if(auto t = typeRef())
+		{
+			std::string length;
+			child()->readIdentifier(length);
+			return Contract::Array{std::make_shared<Contract::TypeRef>(*t), std::stoul(length)};
+		}
+		else
+		{
+			throw std::runtime_error("Invalid array element type");
+		}
+	}
+
 	std::vector<Contract::Var> varList()
 	{
 		std::vector<Contract::Var> ret;
@@ -239,7 +330,7 @@ class ContractDeserializer: public ContractSerDes
 			std::string docs;
 			child()->readText(docs);
 
-			ret.emplace_back(name, *t, docs);
+			ret.emplace_back(name, *t, docs, annotations(6));
 		}
 
 		return ret;
@@ -255,7 +346,7 @@ class ContractDeserializer: public ContractSerDes
 		child()->readIdentifier(name);
 		auto ret = typeRef();
 		auto args = varList();
-		return Contract::Function({name, args}, ret);
+		return Contract::Function({name, args, annotations(6)}, ret);
 	}
 
 	Contract::Function action()
@@ -263,7 +354,7 @@ class ContractDeserializer: public ContractSerDes
 		std::string name;
 		child()->readIdentifier(name);
 		auto args = varList();
-		return {Contract::Action{name, args}, {}};
+		return {Contract::Action{name, args, annotations(6)}, {}};
 	}
 
 	std::string aliasRef()
@@ -290,20 +381,47 @@ class ContractDeserializer: public ContractSerDes
 			return primitive();
 		case TypeDefSelector::Collection:
 			return collection();
+		case TypeDefSelector::Bounded:
+			return bounded();
 		case TypeDefSelector::Aggregate:
 			return aggregate();
+		case TypeDefSelector::Array:
+			return array();
 		default:
 			return aliasRef();
 		}
 	}
 
+	/// Annotations are not present in the data written before the format version that introduced them (nor their arguments).
+	std::vector<Contract::Annotation> annotations(int since)
+	{
+		std::vector<Contract::Annotation> ret;
+
+		if(child()->hasVersion(since))
+		{
+			for(std::string a; child()->readIdentifier(a), a.length();)
+			{
+				std::string value;
+
+				if(child()->hasVersion(6))
+				{
+					child()->readIdentifier(value);
+				}
+
+				ret.push_back({a, value.length() ? std::optional<size_t>(std::stoul(value)) : std::nullopt});
+			}
+		}
+
+		return ret;
+	}
+
 	Contract::Alias alias()
 	{
 		std::string name;
 		child()->readIdentifier(name);
 		const auto t = typeDef();
 		aliases.insert({name, t});
-		return Contract::Alias{name, t};
+		return Contract::Alias{name, t, annotations(2)};
 	}
 
 	template<class R>
@@ -375,7 +493,7 @@ public:
 					std::string name, docs;
 					child()->readIdentifier(name);
 					child()->readText(docs);
-					ret.push_back({std::move(items), std::move(name), std::move(docs)});
+					ret.push_back({std::move(items), std::move(name), std::move(docs), annotations(1)});
 				}
 			}
 		}
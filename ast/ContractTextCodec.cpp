@@ -40,6 +40,8 @@ template<>struct Mapping<ContractSerDes::TypeRefSelector>: ContractSerDes
 {
 	static constexpr char nameChar = '?';
 	static constexpr char collChar = '[';
+	static constexpr char arrChar = '|';
+	static constexpr char bndChar = '<';
 	static constexpr char primChar = '$';
 	static constexpr char noneChar = ',';
 
@@ -49,6 +51,8 @@ template<>struct Mapping<ContractSerDes::TypeRefSelector>: ContractSerDes
 		{
 			case TypeRefSelector::Alias: return nameChar;
 			case TypeRefSelector::Collection: return collChar;
+			case TypeRefSelector::Array: return arrChar;
+			case TypeRefSelector::Bounded: return bndChar;
 			case TypeRefSelector::Primitive: return primChar;
 			case TypeRefSelector::None: return noneChar;
 			default: throw std::runtime_error("Invalid input to encoder");
@@ -61,6 +65,8 @@ template<>struct Mapping<ContractSerDes::TypeRefSelector>: ContractSerDes
 		{
 			case nameChar: return TypeRefSelector::Alias;
 			case collChar: return TypeRefSelector::Collection;
+			case arrChar: return TypeRefSelector::Array;
+			case bndChar: return TypeRefSelector::Bounded;
 			case primChar: return TypeRefSelector::Primitive;
 			case noneChar: return TypeRefSelector::None;
 			default: throw std::runtime_error("Invalid code found during decoding");
@@ -72,6 +78,8 @@ template<>struct Mapping<ContractSerDes::TypeDefSelector>: ContractSerDes
 {
 	static constexpr char nameChar = ':';
 	static constexpr char collChar = ']';
+	static constexpr char arrChar = '/';
+	static constexpr char bndChar = '>';
 	static constexpr char primChar = '#';
 	static constexpr char aggrChar = '{';
 
@@ -81,6 +89,8 @@ template<>struct Mapping<ContractSerDes::TypeDefSelector>: ContractSerDes
 		{
 			case TypeDefSelector::Alias: return nameChar;
 			case TypeDefSelector::Collection: return collChar;
+			case TypeDefSelector::Array: return arrChar;
+			case TypeDefSelector::Bounded: return bndChar;
 			case TypeDefSelector::Primitive: return primChar;
 			case TypeDefSelector::Aggregate: return aggrChar;
 			default: throw std::runtime_error("Invalid input to encoder");
@@ -93,6 +103,8 @@ template<>struct Mapping<ContractSerDes::TypeDefSelector>: ContractSerDes
 		{
 			case nameChar: return TypeDefSelector::Alias;
 			case collChar: return TypeDefSelector::Collection;
+			case arrChar: return TypeDefSelector::Array;
+			case bndChar: return TypeDefSelector::Bounded;
 			case primChar: return TypeDefSelector::Primitive;
 			case aggrChar: return TypeDefSelector::Aggregate;
 			default: throw std::runtime_error("Invalid code found during decoding");
@@ -148,6 +160,7 @@ template<>struct Mapping<Contract::Primitive>: ContractSerDes
 			case Contract::Primitive::I8: return '6';
 			case Contract::Primitive::U8: return '7';
 			case Contract::Primitive::Bool: return '8';
+			case Contract::Primitive::String: return '9';
 			default: throw std::runtime_error("Invalid input to encoder");
 		}
 	}
@@ -165,6 +178,7 @@ template<>struct Mapping<Contract::Primitive>: ContractSerDes
 			case '6': return Contract::Primitive::I8;
 			case '7': return Contract::Primitive::U8;
 			case '8': return Contract::Primitive::Bool;
+			case '9': return Contract::Primitive::String;
 			default: throw std::runtime_error("Invalid code found during decoding");
 		}
 	}
@@ -198,7 +212,12 @@ struct TextSink: ContractSerializer<TextSink>
 struct TextSource: ContractDeserializer<TextSource>
 {
 	std::istream &is;
-	TextSource(std::istream &input): is(input) {}
+	const int version;
+	TextSource(std::istream &input, int version): is(input), version(version) {}
+
+	inline bool hasVersion(int v) const {
+		return version >= v;
+	}
 
 	template<class S>
 	inline void read(S &v)
@@ -240,7 +259,7 @@ struct TextSource: ContractDeserializer<TextSource>
 
 std::string serializeText(const std::vector<Contract>& ast)
 {
-	static constexpr const auto version = 0;
+	static constexpr const auto version = 6;
 
 	TextSink snk;
 	snk.traverse(ast);
@@ -263,7 +282,13 @@ std::vector<Contract> deserializeText(std::istream& input)
 	switch(version)
 	{
 	case 0:
-		return TextSource(input).build();
+	case 1:
+	case 2:
+	case 3:
+	case 4:
+	case 5:
+	case 6:
+		return TextSource(input, version).build();
 	default:
 		throw std::runtime_error("Unsupported version: " + std::to_string((int)v));
 	}
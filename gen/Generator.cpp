@@ -1,9 +1,11 @@
 #include "Generator.h"
 
+#include "RenderCache.h"
 #include "cpp/Cpp.h"
 
 #include <map>
 #include <iostream>
+#include <fstream>
 
 GeneratorOptions::GeneratorOptions(): language(&CodeGenCpp::instance) {}
 
@@ -31,13 +33,87 @@ void GeneratorOptions::select(const std::string &str)
 	}
 }
 
-std::string GeneratorOptions::invokeGenerator(const std::vector<Contract>& ast, std::optional<std::string> name)
+std::string CodeGen::Options::fingerprint() const
+{
+	std::string ret;
+	ret += doClient ? 'c' : '-';
+	ret += doService ? 's' : '-';
+	ret += explicitInstantiation ? 'x' : '-';
+	ret += module ? 'm' : '-';
+	ret += lean ? 'l' : '-';
+	ret += packed ? 'p' : '-';
+	ret += wireSizes ? 'w' : '-';
+	ret += numericIds ? 'n' : '-';
+	ret += staticDispatch ? 'd' : '-';
+	ret += sharedLinks ? 'k' : '-';
+	ret += staticExports ? 'e' : '-';
+	ret += views ? 'v' : '-';
+	ret += arena ? 'a' : '-';
+	ret += accessors ? 'r' : '-';
+	ret += builders ? 'b' : '-';
+	ret += unrolledSerdes ? 'u' : '-';
+	ret += columns ? 'o' : '-';
+	ret += reorderMembers ? 'y' : '-';
+	return ret;
+}
+
+/*
+ * The cache of a file is named after its full path, so that outputs of the same name in
+ * different directories (like the jobs of a batch) do not share one. The hash does not need
+ * to be stable across builds, as the cache is discarded by a rebuild of the tool anyway.
+ */
+static inline std::string cacheFileName(const std::string& name, const std::optional<std::filesystem::path>& output)
+{
+	if(output)
+	{
+		std::stringstream ss;
+		ss << name << "." << std::hex << std::hash<std::string>{}(std::filesystem::absolute(*output).lexically_normal().string()) << ".cache";
+		return ss.str();
+	}
+
+	return name + ".cache";
+}
+
+std::string GeneratorOptions::resolveName(const std::vector<Contract>& ast, const std::optional<std::string>& name) const {
+	return this->name.value_or(name.value_or(ast.front().name));
+}
+
+std::string GeneratorOptions::invokeGenerator(const std::vector<Contract>& ast, std::optional<std::string> name, const std::optional<std::filesystem::path>& output) const
 {
 	if(ast.size())
 	{
-		const auto n = this->name.value_or(name.value_or(ast.front().name));
-		return language->generate(ast, n, doClient, doService);
+		const auto n = resolveName(ast, name);
+		std::optional<RenderCache> cache;
+
+		if(cacheDir)
+		{
+			cache.emplace(*cacheDir / cacheFileName(n, output));
+		}
+
+		return language->generate(ast, n, *this, cache ? &*cache : nullptr);
 	}
 
 	return {};
 }
+
+void GeneratorOptions::writeInstantiationUnit(const std::vector<Contract>& ast, const std::filesystem::path& header) const
+{
+	if(explicitInstantiation && ast.size())
+	{
+		const auto path = std::filesystem::path(header).replace_extension(".cpp");
+
+		if(path == header)
+		{
+			throw std::runtime_error("Explicit instantiation unit for '" + header.string() + "' would overwrite the output itself");
+		}
+
+		// Named the same as the header, so that a module implementation unit belongs to the interface.
+		const auto file = header.filename().string();
+		std::ofstream output(path, std::ios::binary);
+
+		if(!(output << language->generateInstantiations(ast, resolveName(ast, file), file, *this)))
+		{
+			throw std::runtime_error("Explicit instantiation unit '" + path.string() + "' could not be written");
+		}
+	}
+}
@@ -4,17 +4,30 @@
 #include "ast/Contract.h"
 
 #include <sstream>
+#include <filesystem>
+
+class RenderCache;
 
 struct CodeGen
 {
+	/// Switches controlling the generated source.
+	struct Options
+	{
+		bool doClient = false, doService = false, explicitInstantiation = false, module = false, lean = false, packed = false, wireSizes = false, numericIds = false, staticDispatch = false, sharedLinks = false, staticExports = false, views = false, arena = false, accessors = false, builders = false, unrolledSerdes = false, columns = false, reorderMembers = false;
+		std::optional<std::filesystem::path> cacheDir;
+
+		/// Identifies the settings that affect the generated output (used for caching).
+		std::string fingerprint() const;
+	};
+
 	inline virtual ~CodeGen() = default;
-	virtual std::string generate(const std::vector<Contract>& ast, const std::string& name, bool generateClientProxy, bool generateServiceProxy) const = 0;
+	virtual std::string generate(const std::vector<Contract>& ast, const std::string& name, const Options& opts, RenderCache* cache) const = 0;
+	virtual std::string generateInstantiations(const std::vector<Contract>& ast, const std::string& name, const std::string& header, const Options& opts) const = 0;
 };
 
-struct GeneratorOptions
+struct GeneratorOptions: CodeGen::Options
 {
 	const CodeGen* language;
-	bool doClient = false, doService = false;
 	std::optional<std::string> name;
 
 	void select(const std::string &str);
@@ -44,9 +57,101 @@ public:
 		{
 			this->doService = true;
 		});
+
+		h->addOption("--lean", "Generate a single compactly checked template per proxy method [default: don't]", [this]()
+		{
+			this->lean = true;
+		});
+
+		h->addOption("--packed", "Generate packed, bulk copied layouts for aggregates of fixed wire size [default: don't]", [this]()
+		{
+			this->packed = true;
+		});
+
+		h->addOption("--wire-sizes", "Generate the wire sizes of the types and calls (constants for the fixed size ones) [default: don't]", [this]()
+		{
+			this->wireSizes = true;
+		});
+
+		h->addOption("--numeric-ids", "Bind methods by a 32-bit identifier derived from their name and structure instead of their name [default: don't]", [this]()
+		{
+			this->numericIds = true;
+		});
+
+		h->addOption("--static-dispatch", "Dispatch the calls to the service through a table shared by all instances (implies --numeric-ids) [default: don't]", [this]()
+		{
+			this->staticDispatch = this->numericIds = true;
+		});
+
+		h->addOption("--shared-links", "Keep the links of the client in a table shared by the proxies on the same endpoint [default: don't]", [this]()
+		{
+			this->sharedLinks = true;
+		});
+
+		h->addOption("--static-exports", "Export the methods of a session through a single table per session type [default: don't]", [this]()
+		{
+			this->staticExports = true;
+		});
+
+		h->addOption("--views", "Generate aliases that receive the collections as views into the message instead of copies [default: don't]", [this]()
+		{
+			this->views = true;
+		});
+
+		h->addOption("--arena", "Generate aliases that keep the collections of a received call in a single arena [default: don't]", [this]()
+		{
+			this->arena = true;
+		});
+
+		h->addOption("--accessors", "Generate accessors that decode the fields of a received message on demand [default: don't]", [this]()
+		{
+			this->accessors = true;
+		});
+
+		h->addOption("--builders", "Generate builders that write outgoing messages straight into the output buffer [default: don't]", [this]()
+		{
+			this->builders = true;
+		});
+
+		h->addOption("--unrolled-serdes", "Generate the serialization of aggregates as straight-line code instead of member lists [default: don't]", [this]()
+		{
+			this->unrolledSerdes = true;
+		});
+
+		h->addOption("--columns", "Generate structure-of-arrays containers for the collections of aggregates [default: don't]", [this]()
+		{
+			this->columns = true;
+		});
+
+		h->addOption("--reorder-members", "Order the members of the generated structures for minimal padding (the wire order is kept) [default: don't]", [this]()
+		{
+			this->reorderMembers = true;
+		});
+
+		h->addOption("--module", "Generate a C++20 module interface unit instead of a header [default: don't]", [this]()
+		{
+			this->module = true;
+		});
+
+		h->addOption("--explicit-instantiation", "Declare the instantiations of the contract's own types extern and define them in a companion source next to the output [default: don't]", [this]()
+		{
+			this->explicitInstantiation = true;
+		});
+
+		h->addOption("--cache", "Reuse the code rendered for unchanged items from (and store it into) the specified directory [default: don't]", [this](const std::string &p)
+		{
+			this->cacheDir = p;
+		});
 	}
 
-	std::string invokeGenerator(const std::vector<Contract>& ast, std::optional<std::string> name);
+	/// The name the output is generated for: the one set explicitly, the one given, or that of the first contract (in this order).
+	std::string resolveName(const std::vector<Contract>& ast, const std::optional<std::string>& name) const;
+
+	/// Generates the source to be written to the specified output (if it goes to a file), which also identifies the render cache.
+	std::string invokeGenerator(const std::vector<Contract>& ast, std::optional<std::string> name, const std::optional<std::filesystem::path>& output = {}) const;
+
+	/// Writes the explicit instantiation unit belonging to the specified generated header (if requested).
+	void writeInstantiationUnit(const std::vector<Contract>& ast, const std::filesystem::path& header) const;
 };
 
 #endif /* RPC_TOOL_GEN_GENERATOR_H_ */
@@ -0,0 +1,139 @@
+#include "RenderCache.h"
+
+#include <thread>
+#include <fstream>
+#include <sstream>
+#include <iostream>
+
+#include <unistd.h>
+
+static constexpr const char* magic = "roll-contract-tool render cache v1";
+
+/*
+ * Identifies the executable by its size and modification time, any rebuild
+ * of the tool invalidates the previously cached output.
+ */
+static inline std::string toolVersion()
+{
+	std::error_code ec;
+	const auto exe = std::filesystem::read_symlink("/proc/self/exe", ec);
+
+	if(!ec)
+	{
+		const auto size = std::filesystem::file_size(exe, ec);
+
+		if(!ec)
+		{
+			const auto time = std::filesystem::last_write_time(exe, ec);
+
+			if(!ec)
+			{
+				return std::to_string(size) + ":" + std::to_string(time.time_since_epoch().count());
+			}
+		}
+	}
+
+	return {};
+}
+
+template<class T>
+static inline bool readValue(std::istream& is, T& v) {
+	return (bool)is.read((char*)&v, sizeof(v));
+}
+
+template<class T>
+static inline void writeValue(std::ostream& os, const T& v) {
+	os.write((const char*)&v, sizeof(v));
+}
+
+RenderCache::RenderCache(std::filesystem::path path): path(std::move(path))
+{
+	std::ifstream is(this->path, std::ios::binary);
+	std::string header;
+
+	if(!is || !std::getline(is, header) || header != magic + (":" + toolVersion()))
+	{
+		return;
+	}
+
+	decltype(stored) entries;
+	uint64_t key;
+
+	while(readValue(is, key))
+	{
+		uint32_t count;
+		if(!readValue(is, count))
+		{
+			return;
+		}
+
+		std::vector<std::string> strs;
+
+		for(auto i = 0u; i < count; i++)
+		{
+			uint32_t length;
+			if(!readValue(is, length))
+			{
+				return;
+			}
+
+			std::string str(length, '\0');
+			if(!is.read(str.data(), length))
+			{
+				return;
+			}
+
+			strs.push_back(std::move(str));
+		}
+
+		entries.emplace(key, std::move(strs));
+	}
+
+	stored = std::move(entries);
+}
+
+RenderCache::~RenderCache()
+{
+	const auto version = toolVersion();
+
+	if(version.empty())
+	{
+		return;
+	}
+
+	std::error_code ec;
+	std::filesystem::create_directories(path.parent_path(), ec);
+
+	// Unique to the thread, as the workers of a batch may be saving caches at the same time.
+	std::stringstream suffix;
+	suffix << "." << getpid() << "." << std::hex << std::hash<std::thread::id>{}(std::this_thread::get_id());
+
+	auto temp = path;
+	temp += suffix.str();
+
+	{
+		std::ofstream os(temp, std::ios::binary);
+		os << magic << ":" << version << "\n";
+
+		for(const auto &e: used)
+		{
+			writeValue(os, e.first);
+			writeValue(os, (uint32_t)e.second.size());
+
+			for(const auto &s: e.second)
+			{
+				writeValue(os, (uint32_t)s.length());
+				os.write(s.data(), s.length());
+			}
+		}
+
+		if(!os)
+		{
+			std::cerr << "Warning: render cache '" << path.string() << "' could not be saved" << std::endl;
+			std::filesystem::remove(temp, ec);
+			return;
+		}
+	}
+
+	std::filesystem::rename(temp, path, ec);
+}
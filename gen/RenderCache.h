@@ -0,0 +1,45 @@
+#ifndef RPC_TOOL_GEN_RENDERCACHE_H_
+#define RPC_TOOL_GEN_RENDERCACHE_H_
+
+#include <map>
+#include <string>
+#include <vector>
+#include <cstdint>
+#include <filesystem>
+
+/*
+ * Persistent store of code snippets rendered for contract items, keyed by a hash
+ * of everything the rendering depends on (the item itself, the type definitions
+ * it refers to, the output section and the generator options).
+ *
+ * The stored data is only considered valid for the very same build of the tool
+ * that produced it. Only the entries that were used during the current run are
+ * saved, so items that are removed from the contract do not accumulate.
+ */
+class RenderCache
+{
+	const std::filesystem::path path;
+	std::map<uint64_t, std::vector<std::string>> stored, used;
+
+public:
+	RenderCache(std::filesystem::path path);
+	~RenderCache();
+
+	template<class F>
+	const std::vector<std::string>& get(uint64_t key, F&& render)
+	{
+		if(auto it = used.find(key); it != used.end())
+		{
+			return it->second;
+		}
+
+		if(auto it = stored.find(key); it != stored.end())
+		{
+			return used.emplace(key, std::move(it->second)).first->second;
+		}
+
+		return used.emplace(key, render()).first->second;
+	}
+};
+
+#endif /* RPC_TOOL_GEN_RENDERCACHE_H_ */
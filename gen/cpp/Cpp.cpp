@@ -7,6 +7,11 @@
 #include "CppServerProxy.h"
 #include "CppSessionProxy.h"
 #include "CppStructSerdes.h"
+#include "CppInstantiationGen.h"
+#include "CppWireSizeGen.h"
+#include "CppAccessorGen.h"
+#include "CppBuilderGen.h"
+#include "CppColumnGen.h"
 
 const CodeGenCpp CodeGenCpp::instance;
 
@@ -22,27 +27,102 @@ static inline std::string allcapsEscape(const std::string &str)
 	return ret;
 }
 
-std::string CodeGenCpp::generate(const std::vector<Contract>& cs, const std::string& name, bool doClient, bool doService) const
+static inline std::string moduleName(const std::string &str)
 {
-	std::stringstream ss;
+	std::string ret = std::filesystem::path(str).stem().string();
 
-	const auto guardMacroName = "_" + allcapsEscape(name) + "_";
+	for(auto& c: ret)
+	{
+		if(!std::isalnum(c))
+		{
+			c = '_';
+		}
+	}
 
-	ss << "#ifndef " << guardMacroName << std::endl;
-	ss << "#define " << guardMacroName << std::endl << std::endl;
+	if(ret.empty() || std::isdigit(ret[0]))
+	{
+		ret = "_" + ret;
+	}
+
+	return ret;
+}
+
+static inline bool usesType(const std::vector<Contract>& cs, const std::function<bool(const Contract::TypeDef&)>& p) {
+	return std::any_of(cs.begin(), cs.end(), [&p](const auto& c){ return usesType(c, p); });
+}
+
+static inline bool usesArrays(const std::vector<Contract>& cs) {
+	return usesType(cs, [](const auto& t){ return std::holds_alternative<Contract::Array>(t); });
+}
+
+static inline bool usesStrings(const std::vector<Contract>& cs)
+{
+	return usesType(cs, [](const auto& t){
+		const auto p = std::get_if<Contract::Primitive>(&t);
+		return p && *p == Contract::Primitive::String;
+	});
+}
+
+static inline bool usesBoundedCollections(const std::vector<Contract>& cs)
+{
+	return usesType(cs, [](const auto& t){
+		const auto c = std::get_if<Contract::Collection>(&t);
+		return c && c->capacity.has_value();
+	});
+}
+
+static inline void writeIncludes(std::stringstream &ss, const std::vector<Contract>& cs, const CodeGen::Options& opts)
+{
+	if(opts.packed) ss << "#include <cstddef>" << std::endl;
+	if(opts.wireSizes) ss << "#include <type_traits>" << std::endl;
+	if(opts.columns) ss << "#include <vector>" << std::endl;
+	if(opts.packed || opts.wireSizes || opts.columns) ss << std::endl;
 
 	ss << "#include \"base/Call.h\"" << std::endl;
 	ss << "#include \"base/Symbol.h\"" << std::endl << std::endl;
 
 	ss << "#include \"types/Collection.h\"" << std::endl;
-	ss << "#include \"types/StructTypeInfo.h\"" << std::endl << std::endl;
+	if(usesArrays(cs)) ss << "#include \"types/Array.h\"" << std::endl;
+	if(usesBoundedCollections(cs)) ss << "#include \"types/InlineMany.h\"" << std::endl;
+	if(usesStrings(cs)) ss << "#include \"types/String.h\"" << std::endl;
+	ss << "#include \"types/StructTypeInfo.h\"" << std::endl;
+	if(opts.accessors) ss << "#include \"types/WireRecord.h\"" << std::endl;
+	if(opts.builders) ss << "#include \"types/WireBuilder.h\"" << std::endl;
+	ss << std::endl;
 
 	ss << "#include \"framework/Session.h\"" << std::endl;
 
-	if(doClient) ss << "#include \"framework/Client.h\"" << std::endl;
-	if(doService) ss << "#include \"framework/Service.h\"" << std::endl;
+	if(opts.doClient) ss << "#include \"framework/Client.h\"" << std::endl;
+	if(opts.doService) ss << "#include \"framework/Service.h\"" << std::endl;
 
 	ss << std::endl;
+}
+
+std::string CodeGenCpp::generate(const std::vector<Contract>& cs, const std::string& name, const Options& opts, RenderCache* cache) const
+{
+	std::stringstream ss;
+
+	const GenContext ctx{opts, cache};
+	const auto doClient = opts.doClient, doService = opts.doService;
+
+	const auto guardMacroName = "_" + allcapsEscape(name) + "_";
+
+	if(opts.module)
+	{
+		ss << "module;" << std::endl << std::endl;
+	}
+	else
+	{
+		ss << "#ifndef " << guardMacroName << std::endl;
+		ss << "#define " << guardMacroName << std::endl << std::endl;
+	}
+
+	writeIncludes(ss, cs, opts);
+
+	if(opts.module)
+	{
+		ss << "export module " << moduleName(name) << ";" << std::endl << std::endl;
+	}
 
 	for(const auto& c: cs)
 	{
@@ -52,9 +132,44 @@ std::string CodeGenCpp::generate(const std::vector<Contract>& cs, const std::str
 			indent(1) + "class Symbols;",
 		};
 
+		if(opts.views)
+		{
+			members.push_back(indent(1) + "class Views;");
+		}
+
+		if(opts.arena)
+		{
+			members.push_back(indent(1) + "class ArenaTypes;");
+		}
+
+		if(opts.columns)
+		{
+			members.push_back(indent(1) + "class Columns;");
+		}
+
+		if(opts.wireSizes)
+		{
+			members.push_back(indent(1) + "class WireSizes;");
+		}
+
+		if(opts.accessors)
+		{
+			members.push_back(indent(1) + "class Accessors;");
+		}
+
+		if(opts.builders)
+		{
+			members.push_back(indent(1) + "class Builders;");
+		}
+
 		if(doClient)
 		{
 			members.push_back(indent(1) + "template<class> class ClientProxy;");
+
+			if(opts.sharedLinks)
+			{
+				members.push_back(indent(1) + "template<class> struct ClientLinks;");
+			}
 		}
 
 		if(doService)
@@ -62,26 +177,90 @@ std::string CodeGenCpp::generate(const std::vector<Contract>& cs, const std::str
 			members.push_back(indent(1) + "template<class, class> class ServerProxy;");
 		}
 
-		writeTopLevelBlock(ss, "struct " + contractRootBlockName(c.name), std::move(members));
+		writeTopLevelBlock(ss, exportKeyword(ctx) + "struct " + contractRootBlockName(c.name), std::move(members));
+
+		writeParametricContractTypes(ss, c, ctx);
+		writeStructTypeInfo(ss, c, ctx);
+
+		// Before anything that could implicitly instantiate the types.
+		if(opts.explicitInstantiation)
+		{
+			writeExternTemplates(ss, c, ctx);
+		}
+
+		writeContractTypeAliases(ss, c, ctx);
+
+		if(opts.views)
+		{
+			writeContractViewAliases(ss, c, ctx);
+		}
+
+		if(opts.arena)
+		{
+			writeContractArenaAliases(ss, c, ctx);
+		}
+
+		if(opts.columns)
+		{
+			writeColumns(ss, c, ctx);
+		}
+
+		if(opts.wireSizes)
+		{
+			writeWireSizes(ss, c, ctx);
+		}
+
+		if(opts.accessors)
+		{
+			writeAccessors(ss, c, ctx);
+		}
+
+		if(opts.builders)
+		{
+			writeBuilders(ss, c, ctx);
+		}
 
-		writeParametricContractTypes(ss, c);
-		writeStructTypeInfo(ss, c);
-		writeContractTypeAliases(ss, c);
-		writeContractSymbols(ss, c);
+		writeContractSymbols(ss, c, ctx);
 
 		if(doClient)
 		{
-			writeSessionProxies(ss, c, ClientSessionProxyFilterFactory{});
-			writeClientProxy(ss, c);
+			writeSessionProxies(ss, c, ClientSessionProxyFilterFactory{opts.sharedLinks}, ctx);
+			writeClientProxy(ss, c, ctx);
 		}
 
 		if(doService)
 		{
-			writeSessionProxies(ss, c, ServerSessionProxyFilterFactory{});
-			writeServerProxy(ss, c);
+			writeSessionProxies(ss, c, ServerSessionProxyFilterFactory{opts.staticDispatch}, ctx);
+			writeServerProxy(ss, c, ctx);
 		}
 	}
 
-	ss << std::endl << "#endif /* " << guardMacroName << " */" << std::endl;
+	if(!opts.module)
+	{
+		ss << std::endl << "#endif /* " << guardMacroName << " */" << std::endl;
+	}
+
+	return ss.str();
+}
+
+std::string CodeGenCpp::generateInstantiations(const std::vector<Contract>& cs, const std::string& name, const std::string& header, const Options& opts) const
+{
+	std::stringstream ss;
+	const GenContext ctx{opts, nullptr};
+
+	if(opts.module)
+	{
+		// The global module fragment of the interface is not visible here.
+		ss << "module;" << std::endl << std::endl;
+		writeIncludes(ss, cs, opts);
+		ss << "module " << moduleName(name) << ";" << std::endl << std::endl;
+	}
+	else
+	{
+		ss << "#include \"" << header << "\"" << std::endl << std::endl;
+	}
+
+	writeExplicitInstantiations(ss, cs, ctx);
+
 	return ss.str();
 }
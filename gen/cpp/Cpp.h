@@ -6,7 +6,8 @@
 class CodeGenCpp: public CodeGen
 {
 	inline virtual ~CodeGenCpp() = default;
-	virtual std::string generate(const std::vector<Contract>& contract, const std::string& name, bool doClient, bool doService) const override;
+	virtual std::string generate(const std::vector<Contract>& contract, const std::string& name, const Options& opts, RenderCache* cache) const override;
+	virtual std::string generateInstantiations(const std::vector<Contract>& contract, const std::string& name, const std::string& header, const Options& opts) const override;
 
 public:
 	static const CodeGenCpp instance;
@@ -0,0 +1,226 @@
+#include "CppAccessorGen.h"
+
+#include "CppCommon.h"
+#include "CppWireLayout.h"
+
+#include <algorithm>
+#include <set>
+
+/*
+ * Read-only views of the serialized form of the aggregates and the calls. The whole record is
+ * bounds checked once by the runtime when the accessor is created, after that the fields are only
+ * decoded when read. Fields that are preceded by ones of fixed size only are found at an offset
+ * known at generation time, the rest is located by skipping over the fields before them. Runs of
+ * flags packed into bits are a single field, with an accessor for each bit.
+ */
+struct AccessorGenerator
+{
+	const WireLayout& layout;
+
+	struct Field
+	{
+		std::string name, type;
+		std::optional<size_t> size;
+		std::vector<std::string> flags = {};
+	};
+
+	static inline std::string handleTypeRef(const std::string &n) { return userTypeName(n); }
+	static inline std::string handleTypeRef(const Contract::Primitive& p) { return cppPrimitive(p); }
+
+	/// The capacity of bounded collections is checked by the runtime along with the bounds of the record.
+	static inline std::string handleTypeRef(const Contract::Collection &c) {
+		return "rpc::WireMany<" + std::visit([](const auto& e){return handleTypeRef(e);}, *c.elementType) + (c.capacity ? ", " + std::to_string(*c.capacity) : std::string{}) + ">";
+	}
+
+	static inline std::string handleTypeRef(const Contract::Array &a) {
+		return "rpc::WireArray<" + std::visit([](const auto& e){return handleTypeRef(e);}, *a.elementType) + ", " + std::to_string(a.length) + ">";
+	}
+
+	Field field(const std::string& name, const Contract::TypeRef& t) const
+	{
+		const auto type = std::visit([](const auto& i){ return handleTypeRef(i); }, t);
+		return {name, layout.isVarint(t) ? ("rpc::WireVarint<" + type + ">") : type, std::visit([this](const auto& i){ return layout.fixedSize(i); }, t)};
+	}
+
+	std::vector<Field> fields(const std::vector<Contract::Var>& vs, std::string (*name)(const std::string&)) const
+	{
+		std::vector<Field> ret;
+
+		for(const auto& v: vs)
+		{
+			ret.push_back(field(name(v.name), v.type));
+		}
+
+		return ret;
+	}
+
+	std::vector<Field> fields(const Contract::Aggregate& a) const
+	{
+		std::vector<Field> ret;
+
+		for(const auto& g: layout.groups(a))
+		{
+			if(g.flags)
+			{
+				Field f{{}, "rpc::WireFlags<" + std::to_string(g.count) + ">", WireLayout::flagBytes(g.count)};
+				std::transform(a.members.begin() + g.first, a.members.begin() + g.first + g.count, std::back_inserter(f.flags), [](const auto& m){ return aggregateMemberName(m.name); });
+				ret.push_back(std::move(f));
+			}
+			else
+			{
+				ret.push_back(field(aggregateMemberName(a.members[g.first].name), a.members[g.first].type));
+			}
+		}
+
+		return ret;
+	}
+
+	/// Fields named like the members of rpc::WireRecord used here would hide them, so those get an underscore (names in the contract can not start with one).
+	static inline std::string accessorName(const std::string& n)
+	{
+		static const std::set<std::string> taken = {"field", "flag", "wireSize"};
+		return taken.count(n) ? ("_" + n) : n;
+	}
+
+	static inline std::string offsetArg(const std::optional<size_t>& offset) {
+		return offset ? (", " + std::to_string(*offset)) : std::string{};
+	}
+
+	static inline Field calls(const std::string& name, const size_t n) {
+		return {name, (n == 1) ? "rpc::WireCall" : ("rpc::WireCalls<" + std::to_string(n) + ">"), {}};
+	}
+
+	static inline std::string record(const std::string &name, const std::vector<Field>& fs, const int n)
+	{
+		std::stringstream ss;
+		ss << indent(n) << "struct " << name << ": rpc::WireRecord<";
+
+		for(auto i = 0u; i < fs.size(); i++)
+		{
+			ss << (i ? ", " : "") << fs[i].type;
+		}
+
+		ss << ">" << std::endl << indent(n) << "{" << std::endl;
+		ss << indent(n + 1) << "using WireRecord::WireRecord;" << std::endl;
+
+		std::optional<size_t> offset = 0;
+
+		for(auto i = 0u; i < fs.size(); i++)
+		{
+			if(fs[i].flags.empty())
+			{
+				ss << indent(n + 1) << "inline auto " << accessorName(fs[i].name) << "() const { return this->template field<" << i << offsetArg(offset) << ">(); }" << std::endl;
+			}
+
+			for(auto j = 0u; j < fs[i].flags.size(); j++)
+			{
+				ss << indent(n + 1) << "inline bool " << accessorName(fs[i].flags[j]) << "() const { return this->template flag<" << i << ", " << j << offsetArg(offset) << ">(); }" << std::endl;
+			}
+
+			if(offset && fs[i].size)
+			{
+				*offset += *fs[i].size;
+			}
+			else
+			{
+				offset.reset();
+			}
+		}
+
+		if(offset)
+		{
+			ss << indent(n + 1) << "static constexpr size_t wireSize = " << *offset << ";" << std::endl;
+		}
+
+		ss << indent(n) << "};";
+		return ss.str();
+	}
+
+	void handleTypeDef(std::vector<std::string> &r, const std::string& name, const Contract::Aggregate& a, const int n) const {
+		r.push_back(record(userTypeName(name), fields(a), n));
+	}
+
+	template<class T>
+	void handleTypeDef(std::vector<std::string> &r, const std::string& name, const T& t, const int n) const {
+		r.push_back(indent(n) + "using " + userTypeName(name) + " = " + handleTypeRef(t) + ";");
+	}
+
+	void handleItem(std::vector<std::string> &r, const Contract::Alias &a, const int n) const {
+		std::visit([this, &r, &a, n](const auto& t){ handleTypeDef(r, a.name, t, n); }, a.type);
+	}
+
+	void handleItem(std::vector<std::string> &r, const Contract::Function &f, const int n) const
+	{
+		if(f.returnType)
+		{
+			r.push_back(record(callbackSignatureTypeName(f.name), {field(argumentName("retval"), *f.returnType)}, n));
+
+			auto args = fields(f.args, &argumentName);
+			args.push_back(calls(argumentName("callback"), 1));
+			r.push_back(record(functionSignatureTypeName(f.name), args, n));
+		}
+		else
+		{
+			r.push_back(record(actionSignatureTypeName(f.name), fields(f.args, &argumentName), n));
+		}
+	}
+
+	void handleItem(std::vector<std::string> &r, const Contract::Session &s, const int n) const
+	{
+		std::vector<std::string> result;
+		size_t fwd = 1, bwd = 1;
+
+		for(const auto& it: s.items)
+		{
+			if(auto f = std::get_if<Contract::Session::ForwardCall>(&it.second))
+			{
+				result.push_back(record(sessionForwardCallSignatureTypeName(f->name), fields(f->args, &argumentName), n + 1));
+				fwd++;
+			}
+			else if(auto cb = std::get_if<Contract::Session::CallBack>(&it.second))
+			{
+				result.push_back(record(sessionCallbackSignatureTypeName(cb->name), fields(cb->args, &argumentName), n + 1));
+				bwd++;
+			}
+		}
+
+		for(const auto& it: s.items)
+		{
+			if(auto c = std::get_if<Contract::Session::Ctor>(&it.second))
+			{
+				std::vector<Field> accept;
+
+				if(c->returnType)
+				{
+					accept.push_back(field(argumentName("_retval"), *c->returnType));
+				}
+
+				accept.push_back(calls(argumentName("_exports"), fwd));
+
+				auto create = fields(c->args, &argumentName);
+				create.push_back(calls(argumentName("_exports"), bwd));
+				create.push_back(calls(argumentName("_accept"), 1));
+
+				result.push_back(record(sessionAcceptSignatureTypeName(c->name), accept, n + 1));
+				result.push_back(record(sessionCreateSignatureTypeName(c->name), create, n + 1));
+			}
+		}
+
+		std::stringstream ss;
+		writeBlock(ss, "struct " + sessionNamespaceName(s.name), result, n);
+		ss << ";";
+		r.push_back(ss.str());
+	}
+};
+
+void writeAccessors(std::stringstream &ss, const Contract& c, const GenContext& ctx)
+{
+	const WireLayout layout(c);
+	const AccessorGenerator gen{layout};
+
+	const auto result = renderItems(ctx, c, "accessors", [&gen](auto& r, const auto& i){
+		std::visit([&r, &gen](const auto& i){ gen.handleItem(r, i, 1); }, i.second);
+	});
+
+	writeTopLevelBlock(ss, "struct " + contractAccessorBlockNameRef(c.name), result);
+}
@@ -0,0 +1,338 @@
+#include "CppBuilderGen.h"
+
+#include "CppCommon.h"
+#include "CppWireLayout.h"
+
+#include <map>
+#include <set>
+
+/*
+ * Writers that put the fields of the aggregates and calls straight into the output buffer of the
+ * transport. The stage parameter counts the fields written so far, each setter is only accepted
+ * in its own stage and returns the builder of the next one, so the fields are written in wire
+ * order, exactly once. Collections are reserved by count, the runtime then takes the elements
+ * (and refuses counts over the capacity of bounded collections).
+ * Arrays are of known length, so they are taken as a whole value.
+ * Packed flags are collected by the runtime until the last one of the run is set.
+ */
+struct BuilderGenerator
+{
+	const std::string pName;
+	const std::map<std::string, const Contract::Alias*> &aliases;
+	const WireLayout& layout;
+
+	struct Field
+	{
+		enum class Kind { Primitive, Value, Collection, Nested, Flag, Varint } kind;
+		std::string name, type;
+		size_t bit = 0, count = 0; //< Position in the run of flags, or the capacity of a bounded collection.
+	};
+
+	/// The definition behind a named type, and the name of the aggregate it is if any.
+	std::pair<std::string, const Contract::TypeDef*> resolve(std::string n) const
+	{
+		for(auto i = 0u; i <= aliases.size(); i++)
+		{
+			const auto it = aliases.find(n);
+
+			if(it == aliases.end())
+			{
+				break;
+			}
+
+			const auto& t = it->second->type;
+
+			if(auto s = std::get_if<std::string>(&t))
+			{
+				n = *s;
+				continue;
+			}
+
+			return {n, &t};
+		}
+
+		throw std::runtime_error("unknown type referenced: " + n);
+	}
+
+	std::string element(const Contract::Primitive& p) const { return cppPrimitive(p); }
+
+	std::string element(const Contract::Collection& c) const {
+		return "rpc::WireMany<" + std::visit([this](const auto& e){ return element(e); }, *c.elementType) + (c.capacity ? ", " + std::to_string(*c.capacity) : std::string{}) + ">";
+	}
+
+	std::string element(const Contract::Array& a) const {
+		return "rpc::WireArray<" + std::visit([this](const auto& e){ return element(e); }, *a.elementType) + ", " + std::to_string(a.length) + ">";
+	}
+
+	std::string element(const std::string& n) const
+	{
+		const auto r = resolve(n);
+
+		if(std::holds_alternative<Contract::Aggregate>(*r.second))
+		{
+			return userTypeName(r.first) + "<Out>";
+		}
+
+		return std::visit([this](const auto& t){ return element(t); }, *r.second);
+	}
+
+	std::string element(const Contract::Aggregate&) const {
+		throw std::runtime_error("anonymous aggregate referenced");
+	}
+
+	std::string valueType(const Contract::Primitive& p) const { return cppPrimitive(p); }
+
+	std::string valueType(const Contract::Collection& c) const {
+		return boundedCollection(c, "rpc::Many", std::visit([this](const auto& e){ return valueType(e); }, *c.elementType));
+	}
+
+	std::string valueType(const Contract::Array& a) const {
+		return "std::array<" + std::visit([this](const auto& e){ return valueType(e); }, *a.elementType) + ", " + std::to_string(a.length) + ">";
+	}
+
+	std::string valueType(const std::string& n) const
+	{
+		const auto r = resolve(n);
+
+		if(std::holds_alternative<Contract::Aggregate>(*r.second))
+		{
+			return pName + "::" + userTypeName(r.first) + "<rpc::Many>";
+		}
+
+		return std::visit([this](const auto& t){ return valueType(t); }, *r.second);
+	}
+
+	std::string valueType(const Contract::Aggregate&) const {
+		throw std::runtime_error("anonymous aggregate referenced");
+	}
+
+	Field field(const std::string& name, const Contract::Primitive& p) const {
+		return {Field::Kind::Primitive, name, cppPrimitive(p)};
+	}
+
+	Field field(const std::string& name, const Contract::Collection& c) const {
+		return {Field::Kind::Collection, name, std::visit([this](const auto& e){ return element(e); }, *c.elementType), 0, c.capacity.value_or(0)};
+	}
+
+	Field field(const std::string& name, const Contract::Array& a) const {
+		return {Field::Kind::Value, name, valueType(a)};
+	}
+
+	Field field(const std::string& name, const std::string& n) const
+	{
+		const auto r = resolve(n);
+
+		if(std::holds_alternative<Contract::Aggregate>(*r.second))
+		{
+			return {Field::Kind::Nested, name, userTypeName(r.first) + "<Out>"};
+		}
+
+		return std::visit([this, &name](const auto& t){ return field(name, t); }, *r.second);
+	}
+
+	Field field(const std::string& name, const Contract::Aggregate&) const {
+		throw std::runtime_error("anonymous aggregate referenced");
+	}
+
+	Field field(const std::string& name, const Contract::TypeRef& t) const
+	{
+		if(layout.isVarint(t))
+		{
+			return {Field::Kind::Varint, name, std::visit([this](const auto& e){ return element(e); }, t)};
+		}
+
+		return std::visit([this, &name](const auto& t){ return field(name, t); }, t);
+	}
+
+	std::vector<Field> fields(const std::vector<Contract::Var>& vs, std::string (*name)(const std::string&)) const
+	{
+		std::vector<Field> ret;
+
+		for(const auto& v: vs)
+		{
+			ret.push_back(field(name(v.name), v.type));
+		}
+
+		return ret;
+	}
+
+	std::vector<Field> fields(const Contract::Aggregate& a) const
+	{
+		std::vector<Field> ret;
+
+		for(const auto& g: layout.groups(a))
+		{
+			for(auto i = 0u; i < g.count; i++)
+			{
+				const auto& m = a.members[g.first + i];
+
+				if(g.flags)
+				{
+					ret.push_back({Field::Kind::Flag, aggregateMemberName(m.name), "bool", i, g.count});
+				}
+				else
+				{
+					ret.push_back(field(aggregateMemberName(m.name), m.type));
+				}
+			}
+		}
+
+		return ret;
+	}
+
+	inline Field value(const std::string& name, const std::string& type) const {
+		return {Field::Kind::Value, name, pName + "::" + type + "<rpc::Many>"};
+	}
+
+	/// Fields named like the members of rpc::WireBuilder used here would hide them, so those get an underscore (names in the contract can not start with one).
+	static inline std::string setterName(const std::string& n)
+	{
+		static const std::set<std::string> taken = {"put", "putFlag", "putVarint", "reserve", "nest", "fieldCount"};
+		return taken.count(n) ? ("_" + n) : n;
+	}
+
+	static inline std::string setter(const std::string& rName, const Field& f, const size_t i, const int n)
+	{
+		const auto next = rName + "<Out, " + std::to_string(i + 1) + ">";
+
+		std::stringstream ss;
+		ss << indent(n) << "inline auto " << setterName(f.name) << "(";
+
+		switch(f.kind)
+		{
+			case Field::Kind::Primitive:
+			case Field::Kind::Flag:
+			case Field::Kind::Varint: ss << f.type << " v"; break;
+			case Field::Kind::Value: ss << "const " << f.type << "& v"; break;
+			case Field::Kind::Collection: ss << "size_t n"; break;
+			case Field::Kind::Nested: break;
+		}
+
+		ss << ") &&" << std::endl;
+		ss << indent(n) << "{" << std::endl;
+		ss << indent(n + 1) << "static_assert(I == " << i << ", \"Fields of " << rName << " must be written in wire order\");" << std::endl;
+		ss << indent(n + 1) << "return this->template ";
+
+		switch(f.kind)
+		{
+			case Field::Kind::Primitive:
+			case Field::Kind::Value: ss << "put<" << next << ">(v);"; break;
+			case Field::Kind::Collection: ss << "reserve<" << next << ", " << f.type << (f.count ? ", " + std::to_string(f.count) : std::string{}) << ">(n);"; break;
+			case Field::Kind::Nested: ss << "nest<" << next << ", " << f.type << ">();"; break;
+			case Field::Kind::Flag: ss << "putFlag<" << next << ", " << f.bit << ", " << f.count << ">(v);"; break;
+			case Field::Kind::Varint: ss << "putVarint<" << next << ">(v);"; break;
+		}
+
+		ss << std::endl << indent(n) << "}";
+		return ss.str();
+	}
+
+	static inline std::string record(const std::string &name, const std::vector<Field>& fs, const int n)
+	{
+		std::vector<std::string> result = {
+			indent(n + 1) + "using " + name + "::WireBuilder::WireBuilder;",
+			indent(n + 1) + "static constexpr size_t fieldCount = " + std::to_string(fs.size()) + ";"
+		};
+
+		for(auto i = 0u; i < fs.size(); i++)
+		{
+			result.push_back(setter(name, fs[i], i, n + 1));
+		}
+
+		std::stringstream ss;
+		writeBlock(ss, "template<class Out, size_t I = 0> struct " + name + ": rpc::WireBuilder<Out>", result, n);
+		ss << ";";
+		return ss.str();
+	}
+
+	void handleItem(std::vector<std::string> &r, const Contract::Alias &a, const int n) const
+	{
+		if(auto ag = std::get_if<Contract::Aggregate>(&a.type))
+		{
+			r.push_back(record(userTypeName(a.name), fields(*ag), n));
+		}
+	}
+
+	void handleItem(std::vector<std::string> &r, const Contract::Function &f, const int n) const
+	{
+		if(f.returnType)
+		{
+			r.push_back(record(callbackSignatureTypeName(f.name), {field(argumentName("retval"), *f.returnType)}, n));
+
+			auto args = fields(f.args, &argumentName);
+			args.push_back(value(argumentName("callback"), callbackSignatureTypeName(f.name)));
+			r.push_back(record(functionSignatureTypeName(f.name), args, n));
+		}
+		else
+		{
+			r.push_back(record(actionSignatureTypeName(f.name), fields(f.args, &argumentName), n));
+		}
+	}
+
+	void handleItem(std::vector<std::string> &r, const Contract::Session &s, const int n) const
+	{
+		std::vector<std::string> result;
+		const auto sName = sessionNamespaceName(s.name) + "::";
+
+		for(const auto& it: s.items)
+		{
+			if(auto f = std::get_if<Contract::Session::ForwardCall>(&it.second))
+			{
+				result.push_back(record(sessionForwardCallSignatureTypeName(f->name), fields(f->args, &argumentName), n + 1));
+			}
+			else if(auto cb = std::get_if<Contract::Session::CallBack>(&it.second))
+			{
+				result.push_back(record(sessionCallbackSignatureTypeName(cb->name), fields(cb->args, &argumentName), n + 1));
+			}
+		}
+
+		for(const auto& it: s.items)
+		{
+			if(auto c = std::get_if<Contract::Session::Ctor>(&it.second))
+			{
+				std::vector<Field> accept;
+
+				if(c->returnType)
+				{
+					accept.push_back(field(argumentName("_retval"), *c->returnType));
+				}
+
+				accept.push_back(value(argumentName("_exports"), sName + sessionCallExportTypeName(s.name)));
+
+				auto create = fields(c->args, &argumentName);
+				create.push_back(value(argumentName("_exports"), sName + sessionCallbackExportTypeName(s.name)));
+				create.push_back(value(argumentName("_accept"), sName + sessionAcceptSignatureTypeName(c->name)));
+
+				result.push_back(record(sessionAcceptSignatureTypeName(c->name), accept, n + 1));
+				result.push_back(record(sessionCreateSignatureTypeName(c->name), create, n + 1));
+			}
+		}
+
+		std::stringstream ss;
+		writeBlock(ss, "struct " + sessionNamespaceName(s.name), result, n);
+		ss << ";";
+		r.push_back(ss.str());
+	}
+};
+
+void writeBuilders(std::stringstream &ss, const Contract& c, const GenContext& ctx)
+{
+	std::map<std::string, const Contract::Alias*> aliases;
+
+	for(const auto& i: c.items)
+	{
+		if(auto a = std::get_if<Contract::Alias>(&i.second))
+		{
+			aliases.emplace(a->name, a);
+		}
+	}
+
+	const WireLayout layout(c);
+	const BuilderGenerator gen{contractParametricBlockNameRef(c.name), aliases, layout};
+
+	const auto result = renderItems(ctx, c, "builders", [&gen](auto& r, const auto& i){
+		std::visit([&r, &gen](const auto& i){ gen.handleItem(r, i, 1); }, i.second);
+	});
+
+	writeTopLevelBlock(ss, "struct " + contractBuilderBlockNameRef(c.name), result);
+}
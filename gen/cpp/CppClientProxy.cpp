@@ -31,22 +31,27 @@ struct SymbolReferenceExtractor
 
 	template<class C> static inline void handleItem(std::vector<SymRef> &ret, const C&, const std::string&) {}
 
-	static inline auto gatherSymbolReferences(const Contract& c)
-	{
-		std::vector<SymRef> coll;
+	static inline std::string linkMember(const SymRef& it) {
+		return indent(1) + "Link<decltype(" + it[1] + ")> " + callMemberName(it[0]) + " = " + it[1] + ";";
+	}
 
-		const auto s = contractSymbolsBlockNameRef(c.name);
+	/// Designates the link in the shared table (used instead of the link members).
+	static inline std::string linkReference(const SymRef& it) {
+		return indent(1) + "static constexpr auto " + callMemberName(it[0]) + " = &Links::" + callMemberName(it[0]) + ";";
+	}
 
-		for(const auto& i: c.items) {
-			std::visit([&coll, &s](const auto i){handleItem(coll, i, s);}, i.second);
-		}
+	static inline std::string linkName(const SymRef& it) {
+		return callMemberName(it[0]);
+	}
 
-		std::vector<std::string> strs;
-		std::transform(coll.begin(), coll.end(), std::back_inserter(strs), [](const auto& it) {
-			return indent(1) + "Link<decltype(" + it[1] + ")> " + callMemberName(it[0]) + " = " + it[1] + ";";
+	static inline auto gatherSymbolReferences(const Contract& c, const GenContext& ctx, const std::string& section = "clientLinks", std::string (*f)(const SymRef&) = &linkMember)
+	{
+		return renderItems(ctx, c, section, [f, s{contractSymbolsBlockNameRef(c.name)}](auto& r, const auto& i)
+		{
+			std::vector<SymRef> coll;
+			std::visit([&coll, &s](const auto i){handleItem(coll, i, s);}, i.second);
+			std::transform(coll.begin(), coll.end(), std::back_inserter(r), f);
 		});
-
-		return strs;
 	}
 };
 
@@ -184,7 +189,63 @@ struct MemberFunctionGenerator
 		ss << indent(n) << "}";
 	}
 
-	static inline void handleItem(std::vector<std::string> &ret, const Contract::Function &f, const std::string& docs, const std::string& cName, const int n)
+	/*
+	 * Single template covering both the callback and the future based invocation,
+	 * the former is selected by passing a trailing callback argument.
+	 */
+	static inline void writeLeanCall(std::stringstream &ss, const Contract::Function &f, const std::string& cName, const int n)
+	{
+		const LeanArgs args(f.args, cName);
+		const auto cppRetType = std::visit([&cName](const auto& i) { return cppTypeRef(i, cName); }, f.returnType.value());
+
+		ss << indent(n) << "template<class Ret = void" << LeanArgs::tail(args.templateParams) << ", class... C>" << std::endl;
+		auto params = args.params;
+		params.push_back("C&&... _cb");
+
+		ss << indent(n) << "inline auto " << invocationMemberFunctionName(f.name) << "(" << LeanArgs::list(params) << ")" << std::endl;
+		ss << indent(n) << "{" << std::endl;
+
+		const auto sgn = refSignature(f, f.returnType);
+
+		auto cbConds = args.conds;
+		cbConds.push_back("sizeof...(C) == 1");
+		cbConds.push_back("(" + compatibility("rpc::Arg<0, &C::operator()>", cppRetType) + " && ...)");
+
+		ss << indent(n + 1) << "if constexpr(sizeof...(C) != 0)" << std::endl;
+		ss << indent(n + 1) << "{" << std::endl;
+		ss << aggregateCheck(cbConds, "Call to " + f.name + " must match '" + sgn + "' followed by a callback taking the return value", n + 2);
+		ss << indent(n + 2) << "return this->callWithCallback(" << callMemberName(f.name) << ", rpc::move(_cb)..." << LeanArgs::tail(args.forwards) << ");" << std::endl;
+		ss << indent(n + 1) << "}" << std::endl;
+
+		auto futureConds = args.conds;
+		futureConds.push_back(compatibility("Ret", cppRetType));
+
+		ss << indent(n + 1) << "else" << std::endl;
+		ss << indent(n + 1) << "{" << std::endl;
+		ss << aggregateCheck(futureConds, "Call to " + f.name + " must match '" + sgn + "' with the return type given as the first template argument", n + 2);
+		ss << indent(n + 2) << "return this->template callWithPromise<Ret>(" << callMemberName(f.name) << LeanArgs::tail(args.forwards) << ");" << std::endl;
+		ss << indent(n + 1) << "}" << std::endl;
+
+		ss << indent(n) << "}";
+	}
+
+	static inline void writeLeanAction(std::stringstream &ss, const Contract::Function &f, const std::string& cName, const int n)
+	{
+		const LeanArgs args(f.args, cName);
+
+		if(args.templateParams.size())
+		{
+			ss << indent(n) << "template<" << LeanArgs::list(args.templateParams) << ">" << std::endl;
+		}
+
+		ss << indent(n) << "inline auto " << invocationMemberFunctionName(f.name) << "(" << LeanArgs::list(args.params) << ")" << std::endl;
+		ss << indent(n) << "{" << std::endl;
+		ss << aggregateCheck(args.conds, "Call to " + f.name + " must match '" + refSignature(f) + "'", n + 1);
+		ss << indent(n + 1) << "return this->callAction(" << callMemberName(f.name) << LeanArgs::tail(args.forwards) << ");" << std::endl;
+		ss << indent(n) << "}";
+	}
+
+	static inline void handleItem(std::vector<std::string> &ret, const Contract::Function &f, const std::string& docs, const std::string& cName, const bool lean, const int n)
 	{
 		std::vector<ArgInfo> argInfo;
 
@@ -200,7 +261,18 @@ struct MemberFunctionGenerator
 
 		if(!f.returnType.has_value())
 		{
-			writeActionCall(ss, f.name, argInfo, n);
+			if(lean)
+			{
+				writeLeanAction(ss, f, cName, n);
+			}
+			else
+			{
+				writeActionCall(ss, f.name, argInfo, n);
+			}
+		}
+		else if(lean)
+		{
+			writeLeanCall(ss, f, cName, n);
 		}
 		else
 		{
@@ -334,63 +406,157 @@ struct MemberFunctionGenerator
 		ss << indent(n) << "}";
 	}
 
-	static inline void handleItem(std::vector<std::string> &ret, const Contract::Session &s, const std::string& docs, const std::string& cName, const int n)
+	static inline void writeLeanCreate(std::stringstream &ss, const Contract::Session &s, const Contract::Function &f , const std::string& cName, const int n)
 	{
-		for(const auto i: s.items)
+		const LeanArgs args(f.args, cName);
+		const auto defName = definitionMemberFunctionName(f.name);
+		const auto sObj = clientSessionName(cName, s.name);
+
+		ss << indent(n) << "template<" << (f.returnType.has_value() ? "class Ret = void, " : "") << "class S" << LeanArgs::tail(args.templateParams) << ", class... C>" << std::endl;
+		ss << indent(n) << "inline auto " << defName << "(S _object" << LeanArgs::tail(args.params) << ", C&&... _cb)" << std::endl;
+		ss << indent(n) << "{" << std::endl;
+
+		auto conds = args.conds;
+		conds.insert(conds.begin(), "rpc::hasCrtpBase<" + sObj + ", decltype(*_object)>");
+
+		const auto sym = callMemberName(sessionCtorApiName(s.name, f.name));
+		const auto sgn = "'" + refSignature(f, f.returnType) + "' with a pointer-like object to a CRTP subclass of " + sObj + " as the first argument";
+
+		auto cbConds = conds, futureConds = conds;
+		cbConds.push_back("sizeof...(C) == 1");
+
+		if(f.returnType.has_value())
+		{
+			const auto cppTypeName = std::visit([&cName](const auto &i){return cppTypeRef(i, cName);}, f.returnType.value());
+			cbConds.push_back("(" + compatibility("rpc::Arg<0, &C::operator()>", cppTypeName) + " && ...)");
+			futureConds.push_back(compatibility("Ret", cppTypeName));
+		}
+
+		ss << indent(n + 1) << "if constexpr(sizeof...(C) != 0)" << std::endl;
+		ss << indent(n + 1) << "{" << std::endl;
+		ss << aggregateCheck(cbConds, "Call to " + defName + " must match " + sgn + " followed by a callback", n + 2);
+		ss << indent(n + 2) << "return this->createWithCallback" << (f.returnType.has_value() ? "Retval" : "") << "(" << sym << ", _object, rpc::move(_cb)..." << LeanArgs::tail(args.forwards) << ");" << std::endl;
+		ss << indent(n + 1) << "}" << std::endl;
+		ss << indent(n + 1) << "else" << std::endl;
+		ss << indent(n + 1) << "{" << std::endl;
+		ss << aggregateCheck(futureConds, "Call to " + defName + " must match " + sgn, n + 2);
+
+		if(f.returnType.has_value())
+		{
+			ss << indent(n + 2) << "return this->template createWithPromiseRetval<Ret>(" << sym << ", _object" << LeanArgs::tail(args.forwards) << ");" << std::endl;
+		}
+		else
+		{
+			ss << indent(n + 2) << "return this->createWithPromise(" << sym << ", _object" << LeanArgs::tail(args.forwards) << ");" << std::endl;
+		}
+
+		ss << indent(n + 1) << "}" << std::endl;
+		ss << indent(n) << "}";
+	}
+
+	static inline void handleItem(std::vector<std::string> &ret, const Contract::Session &s, const std::string& docs, const std::string& cName, const bool lean, const int n)
+	{
+		for(const auto& i: s.items)
 		{
 			if(const Contract::Function* f = std::get_if<Contract::Session::Ctor>(&i.second))
 			{
+				if(lean)
 				{
 					std::stringstream ss;
 					ss << printDocs(i.first, n);
-					writeCallbackCreate(ss, s, *f, cName, n);
+					writeLeanCreate(ss, s, *f, cName, n);
 					ret.push_back(ss.str());
 				}
-
+				else
 				{
-					std::stringstream ss;
-					ss << printDocs(i.first, n);
-					writeFutureCreate(ss, s, *f, cName, n);
-					ret.push_back(ss.str());
+					{
+						std::stringstream ss;
+						ss << printDocs(i.first, n);
+						writeCallbackCreate(ss, s, *f, cName, n);
+						ret.push_back(ss.str());
+					}
+
+					{
+						std::stringstream ss;
+						ss << printDocs(i.first, n);
+						writeFutureCreate(ss, s, *f, cName, n);
+						ret.push_back(ss.str());
+					}
 				}
 			}
 		}
 	}
 
-	template<class C> static inline void handleItem(std::vector<std::string> &, const C&, const std::string&, const std::string&, const int n) {}
+	template<class C> static inline void handleItem(std::vector<std::string> &, const C&, const std::string&, const std::string&, const bool, const int n) {}
 
-	static inline auto generateFunctionDefinitions(const Contract& c)
+	static inline auto generateFunctionDefinitions(const Contract& c, const GenContext& ctx)
 	{
-		std::vector<std::string> ret;
-
-		for(const auto& i: c.items) {
-			std::visit([&ret, &c, docs{i.first}](const auto i){handleItem(ret, i, docs, c.name, 1);}, i.second);
-		}
-
-		return ret;
+		return renderItems(ctx, c, "clientMethods", [&c, lean{ctx.opts.lean}](auto& r, const auto& i) {
+			std::visit([&r, &c, lean, docs{i.first}](const auto i){handleItem(r, i, docs, c.name, lean, 1);}, i.second);
+		});
 	}
 };
 
-void writeClientProxy(std::stringstream& ss, const Contract& c)
+void writeClientProxy(std::stringstream& ss, const Contract& c, const GenContext& ctx)
 {
 	const auto n = contractClientProxyNameRef(c.name);
-	const auto symRefs = SymbolReferenceExtractor::gatherSymbolReferences(c);
-	const auto funDefs = MemberFunctionGenerator::generateFunctionDefinitions(c);
+	const auto symRefs = SymbolReferenceExtractor::gatherSymbolReferences(c, ctx);
+	const auto funDefs = MemberFunctionGenerator::generateFunctionDefinitions(c, ctx);
 
 	if(symRefs.size())
 	{
+		const auto linkType = "template<class T> using Link = typename rpc::ClientBase<Adapter>::template OnDemand<T>;";
 		std::vector<std::string> result;
+		std::string base = "rpc::ClientBase<Adapter>";
+
+		if(ctx.opts.sharedLinks)
+		{
+			const auto l = contractClientLinksNameRef(c.name);
+
+			std::vector<std::string> links = {indent(1) + linkType};
+			std::copy(symRefs.begin(), symRefs.end(), std::back_inserter(links));
+			writeTopLevelBlock(ss, "template<class Adapter> struct " + l, links);
+
+			const auto linkRefs = SymbolReferenceExtractor::gatherSymbolReferences(c, ctx, "clientLinkRefs", &SymbolReferenceExtractor::linkReference);
+			const auto linkNames = SymbolReferenceExtractor::gatherSymbolReferences(c, ctx, "clientLinkNames", &SymbolReferenceExtractor::linkName);
+
+			base = "rpc::SharedLinkClientBase<Adapter, " + l + "<Adapter>>";
+			result.push_back(indent(1) + "using Links = " + l + "<Adapter>;");
+			std::copy(linkRefs.begin(), linkRefs.end(), std::back_inserter(result));
 
-		result.push_back(indent(1) + "template<class T> using Link = typename rpc::ClientBase<Adapter>::template OnDemand<T>;");
-		std::copy(symRefs.begin(), symRefs.end(), std::back_inserter(result));
+			std::stringstream ctor;
+			ctor << "public:" << std::endl;
+			ctor << indent(1) << "using " << contractClientProxyNameDef(n) << "::SharedLinkClientBase::SharedLinkClientBase;";
+			result.push_back(ctor.str());
+
+			std::stringstream prefetch;
+			prefetch << indent(1) << "inline auto prefetchAll()" << std::endl;
+			prefetch << indent(1) << "{" << std::endl;
+			prefetch << indent(2) << "return this->prefetch(";
+
+			for(auto i = 0u; i < linkNames.size(); i++)
+			{
+				prefetch << (i ? ", " : "") << linkNames[i];
+			}
+
+			prefetch << ");" << std::endl;
+			prefetch << indent(1) << "}";
+			result.push_back(prefetch.str());
+		}
+		else
+		{
+			result.push_back(indent(1) + linkType);
+			std::copy(symRefs.begin(), symRefs.end(), std::back_inserter(result));
+
+			std::stringstream ctor;
+			ctor << "public:" << std::endl;
+			ctor << indent(1) << "using " << contractClientProxyNameDef(n) << "::ClientBase::ClientBase;";
+			result.push_back(ctor.str());
+		}
 
-		std::stringstream ctor;
-		ctor << "public:" << std::endl;
-		ctor << indent(1) << "using " << contractClientProxyNameDef(n) << "::ClientBase::ClientBase;";
-		result.push_back(ctor.str());
 		std::copy(funDefs.begin(), funDefs.end(), std::back_inserter(result));
 
 		ss << printDocs(c.docs, 0);
-		writeTopLevelBlock(ss, "template<class Adapter> class " + n + ": public rpc::ClientBase<Adapter>", result);
+		writeTopLevelBlock(ss, "template<class Adapter> class " + n + ": public " + base, result);
 	}
 }
@@ -5,6 +5,8 @@
 
 #include <sstream>
 
-void writeClientProxy(std::stringstream&, const Contract&);
+struct GenContext;
+
+void writeClientProxy(std::stringstream&, const Contract&, const GenContext&);
 
 #endif /* RPC_TOOL_GEN_CPP_CPPCLIENTPROXY_CPP_ */
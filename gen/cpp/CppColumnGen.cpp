@@ -0,0 +1,263 @@
+#include "CppColumnGen.h"
+
+#include "CppCommon.h"
+#include "CppWireLayout.h"
+
+#include <algorithm>
+
+/*
+ * Structure-of-arrays form of the collections of aggregates: one contiguous column per member.
+ * It has the same signature, so it goes on the wire exactly like the collection of aggregates,
+ * but the serializer decodes the elements straight into the columns. Generated for every
+ * aggregate, as whether it is used as an element is up to the other items of the contract.
+ * Runs of packed flags are written and read by the runtime together, from the byte columns.
+ */
+struct ColumnGenerator
+{
+	const std::string pName, cName;
+	const WireLayout& layout;
+
+	struct Column
+	{
+		std::string name, type;
+		std::optional<size_t> size;
+	};
+
+	/// Columns that go on the wire together, a single one or a run of packed flags.
+	struct Entry
+	{
+		std::string info;
+		std::vector<std::string> columns;
+		std::optional<size_t> size;
+		std::string adaptor = {};
+
+		/// The i-th element of a column, varint encoded ones are passed through the adaptor of the runtime.
+		inline std::string element(const std::string& c) const {
+			return adaptor.empty() ? ("v." + c + "[i]") : (adaptor + "(v." + c + "[i])");
+		}
+	};
+
+	std::string handleTypeRef(const std::string &n) const { return pName + "::" + userTypeName(n) + "<Collection>"; }
+
+	std::string handleTypeRef(const Contract::Primitive& p) const { return storedPrimitive(p, "Collection"); }
+
+	std::string handleTypeRef(const Contract::Collection &c) const {
+		return boundedCollection(c, "Collection", std::visit([this](const auto& e){return handleTypeRef(e);}, *c.elementType));
+	}
+
+	std::string handleTypeRef(const Contract::Array &a) const {
+		return "std::array<" + std::visit([this](const auto& e){return handleTypeRef(e);}, *a.elementType) + ", " + std::to_string(a.length) + ">";
+	}
+
+	std::vector<Column> columns(const Contract::Aggregate& a) const
+	{
+		std::vector<Column> ret;
+
+		for(const auto& m: a.members)
+		{
+			// Flags are kept as bytes (like on the wire), so that the column is contiguous and addressable.
+			const auto flag = std::holds_alternative<Contract::Primitive>(m.type) && std::get<Contract::Primitive>(m.type) == Contract::Primitive::Bool;
+
+			ret.push_back({
+				aggregateMemberName(m.name),
+				flag ? cppPrimitive(Contract::Primitive::U1) : std::visit([this](const auto& t){ return handleTypeRef(t); }, m.type),
+				std::visit([this](const auto& t){ return layout.fixedSize(t); }, m.type)
+			});
+		}
+
+		return ret;
+	}
+
+	std::vector<Entry> entries(const Contract::Aggregate& a, const std::vector<Column>& cs) const
+	{
+		std::vector<Entry> ret;
+
+		for(const auto& g: layout.groups(a))
+		{
+			if(g.flags)
+			{
+				Entry e{"FlagsInfo<" + std::to_string(g.count) + ">", {}, WireLayout::flagBytes(g.count)};
+				std::transform(cs.begin() + g.first, cs.begin() + g.first + g.count, std::back_inserter(e.columns), [](const auto& c){ return c.name; });
+				ret.push_back(std::move(e));
+			}
+			else
+			{
+				const auto& c = cs[g.first];
+				if(layout.isVarint(a.members[g.first].type))
+				{
+					ret.push_back({"TypeInfo<rpc::Varint<" + c.type + ">>", {c.name}, c.size, "rpc::Varint<" + c.type + ">::ref"});
+				}
+				else
+				{
+					ret.push_back({"TypeInfo<" + c.type + ">", {c.name}, c.size});
+				}
+			}
+		}
+
+		return ret;
+	}
+
+	static inline std::string container(const std::string& name, const std::vector<Column>& cs, const int n)
+	{
+		std::vector<std::string> result;
+
+		for(const auto& c: cs)
+		{
+			result.push_back(indent(n + 1) + "std::vector<" + c.type + "> " + c.name + ";");
+		}
+
+		std::stringstream ss;
+		ss << indent(n + 1) << "inline size_t size() const { return " << cs.front().name << ".size(); }" << std::endl << std::endl;
+		ss << indent(n + 1) << "inline void resize(size_t n)" << std::endl;
+		ss << indent(n + 1) << "{" << std::endl;
+
+		for(const auto& c: cs)
+		{
+			ss << indent(n + 2) << c.name << ".resize(n);" << std::endl;
+		}
+
+		ss << indent(n + 1) << "}";
+		result.push_back(ss.str());
+
+		std::stringstream ret;
+		writeBlock(ret, "template<template<class> class Collection> struct " + name, result, n);
+		ret << ";";
+		return ret.str();
+	}
+
+	static inline std::string elements(const std::vector<Entry>& es, const std::string& op, const int n)
+	{
+		std::stringstream ss;
+		ss << indent(n) << "if(!(";
+
+		for(auto i = 0u; i < es.size(); i++)
+		{
+			ss << (i ? "\n" + indent(n + 1) + "&& " : "") << es[i].info << "::" << op << "(s";
+
+			for(const auto& c: es[i].columns)
+			{
+				ss << ", " << es[i].element(c);
+			}
+
+			ss << ")";
+		}
+
+		ss << "))" << std::endl;
+		ss << indent(n) << "{" << std::endl;
+		ss << indent(n + 1) << "return false;" << std::endl;
+		ss << indent(n) << "}";
+		return ss.str();
+	}
+
+	static inline std::string typeInfo(const std::string& type, const std::string& elementType, const std::vector<Entry>& es, const int n)
+	{
+		size_t fixed = 0;
+		std::vector<Entry> varlen;
+
+		for(const auto& e: es)
+		{
+			if(e.size)
+			{
+				fixed += *e.size;
+			}
+			else
+			{
+				varlen.push_back(e);
+			}
+		}
+
+		std::stringstream ss;
+		ss << indent(n) << "template<template<class> class Collection> struct TypeInfo<" << type << ">" << std::endl;
+		ss << indent(n) << "{" << std::endl;
+		ss << indent(n + 1) << "static constexpr auto sgn = TypeInfo<Collection<" << elementType << ">>::sgn;" << std::endl;
+		ss << indent(n + 1) << "static constexpr bool isFixedSize = false;" << std::endl << std::endl;
+
+		ss << indent(n + 1) << "static inline size_t size(const " << type << "& v)" << std::endl;
+		ss << indent(n + 1) << "{" << std::endl;
+		ss << indent(n + 2) << "auto ret = collectionHeaderSize(v.size())" << (fixed ? " + v.size() * " + std::to_string(fixed) : "") << ";" << std::endl << std::endl;
+
+		if(varlen.size())
+		{
+			ss << indent(n + 2) << "for(size_t i = 0; i < v.size(); i++)" << std::endl;
+			ss << indent(n + 2) << "{" << std::endl;
+
+			for(const auto& e: varlen)
+			{
+				ss << indent(n + 3) << "ret += " << e.info << "::size(" << e.element(e.columns.front()) << ");" << std::endl;
+			}
+
+			ss << indent(n + 2) << "}" << std::endl << std::endl;
+		}
+
+		ss << indent(n + 2) << "return ret;" << std::endl;
+		ss << indent(n + 1) << "}" << std::endl << std::endl;
+
+		ss << indent(n + 1) << "template<class S>" << std::endl;
+		ss << indent(n + 1) << "static inline bool write(S& s, const " << type << "& v)" << std::endl;
+		ss << indent(n + 1) << "{" << std::endl;
+		ss << indent(n + 2) << "if(!writeCollectionHeader(s, v.size()))" << std::endl;
+		ss << indent(n + 2) << "{" << std::endl;
+		ss << indent(n + 3) << "return false;" << std::endl;
+		ss << indent(n + 2) << "}" << std::endl << std::endl;
+		ss << indent(n + 2) << "for(size_t i = 0; i < v.size(); i++)" << std::endl;
+		ss << indent(n + 2) << "{" << std::endl;
+		ss << elements(es, "write", n + 3) << std::endl;
+		ss << indent(n + 2) << "}" << std::endl << std::endl;
+		ss << indent(n + 2) << "return true;" << std::endl;
+		ss << indent(n + 1) << "}" << std::endl << std::endl;
+
+		ss << indent(n + 1) << "template<class S>" << std::endl;
+		ss << indent(n + 1) << "static inline bool read(S& s, " << type << "& v)" << std::endl;
+		ss << indent(n + 1) << "{" << std::endl;
+		ss << indent(n + 2) << "size_t n;" << std::endl << std::endl;
+		ss << indent(n + 2) << "if(!readCollectionHeader(s, n))" << std::endl;
+		ss << indent(n + 2) << "{" << std::endl;
+		ss << indent(n + 3) << "return false;" << std::endl;
+		ss << indent(n + 2) << "}" << std::endl << std::endl;
+		// The count comes from the peer, so the columns grow with the elements actually decoded instead of being sized up front.
+		ss << indent(n + 2) << "v.resize(0);" << std::endl << std::endl;
+		ss << indent(n + 2) << "for(size_t i = 0; i < n; i++)" << std::endl;
+		ss << indent(n + 2) << "{" << std::endl;
+		ss << indent(n + 3) << "v.resize(i + 1);" << std::endl << std::endl;
+		ss << elements(es, "read", n + 3) << std::endl;
+		ss << indent(n + 2) << "}" << std::endl << std::endl;
+		ss << indent(n + 2) << "return true;" << std::endl;
+		ss << indent(n + 1) << "}" << std::endl;
+
+		ss << indent(n) << "};";
+		return ss.str();
+	}
+
+	void handleItem(std::vector<std::string> &types, std::vector<std::string> &infos, const Contract::Alias &a) const
+	{
+		if(auto ag = std::get_if<Contract::Aggregate>(&a.type); ag && ag->members.size())
+		{
+			const auto name = userTypeName(a.name);
+			const auto cs = columns(*ag);
+			types.push_back(container(name, cs, 1));
+			infos.push_back(typeInfo(contractColumnBlockNameRef(cName) + "::" + name + "<Collection>", pName + "::" + name + "<Collection>", entries(*ag, cs), 1));
+		}
+	}
+
+	template<class T>
+	void handleItem(std::vector<std::string> &, std::vector<std::string> &, const T&) const {}
+};
+
+void writeColumns(std::stringstream &ss, const Contract& c, const GenContext& ctx)
+{
+	const WireLayout layout(c);
+	const ColumnGenerator gen{contractParametricBlockNameRef(c.name), c.name, layout};
+
+	const auto types = renderItems(ctx, c, "columns", [&gen](auto& r, const auto& i){
+		std::vector<std::string> infos;
+		std::visit([&r, &infos, &gen](const auto& i){ gen.handleItem(r, infos, i); }, i.second);
+	});
+
+	const auto infos = renderItems(ctx, c, "columnTypeInfo", [&gen](auto& r, const auto& i){
+		std::vector<std::string> types;
+		std::visit([&r, &types, &gen](const auto& i){ gen.handleItem(types, r, i); }, i.second);
+	});
+
+	writeTopLevelBlock(ss, "struct " + contractColumnBlockNameRef(c.name), types);
+	writeTopLevelBlock(ss, "namespace rpc", infos, false);
+}
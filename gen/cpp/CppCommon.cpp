@@ -1,5 +1,12 @@
 #include "CppCommon.h"
 
+#include "gen/RenderCache.h"
+#include "ast/ContractTextCodec.h"
+#include "ast/ContentHash.h"
+
+#include <set>
+#include <map>
+
 std::string printDocs(const std::string& str, const int n)
 {
 	std::stringstream ss;
@@ -96,3 +103,188 @@ void writeTopLevelBlock(std::stringstream& ss, const std::string &header, const
 		ss << (addSemi ? ";" : "") << std::endl << std::endl;
 	}
 }
+
+static inline void gatherAliases(std::set<std::string>& ret, const std::map<std::string, const Contract::Alias*>& aliases, const Contract::TypeDef& t);
+
+static inline void gatherAliases(std::set<std::string>& ret, const std::map<std::string, const Contract::Alias*>& aliases, const Contract::TypeRef& t)
+{
+	std::visit([&ret, &aliases](const auto& t){ gatherAliases(ret, aliases, Contract::TypeDef{t}); }, t);
+}
+
+static inline void gatherAliases(std::set<std::string>& ret, const std::map<std::string, const Contract::Alias*>& aliases, const std::vector<Contract::Var>& vs)
+{
+	for(const auto& v: vs)
+	{
+		gatherAliases(ret, aliases, v.type);
+	}
+}
+
+static inline void gatherAliases(std::set<std::string>& ret, const std::map<std::string, const Contract::Alias*>& aliases, const Contract::TypeDef& t)
+{
+	if(auto n = std::get_if<std::string>(&t))
+	{
+		if(auto it = aliases.find(*n); it != aliases.end() && ret.insert(*n).second)
+		{
+			gatherAliases(ret, aliases, it->second->type);
+		}
+	}
+	else if(auto c = std::get_if<Contract::Collection>(&t))
+	{
+		gatherAliases(ret, aliases, *c->elementType);
+	}
+	else if(auto r = std::get_if<Contract::Array>(&t))
+	{
+		gatherAliases(ret, aliases, *r->elementType);
+	}
+	else if(auto a = std::get_if<Contract::Aggregate>(&t))
+	{
+		gatherAliases(ret, aliases, a->members);
+	}
+}
+
+static inline void gatherAliases(std::set<std::string>& ret, const std::map<std::string, const Contract::Alias*>& aliases, const Contract::Function& f)
+{
+	gatherAliases(ret, aliases, f.args);
+
+	if(f.returnType)
+	{
+		gatherAliases(ret, aliases, *f.returnType);
+	}
+}
+
+static inline void gatherAliases(std::set<std::string>& ret, const std::map<std::string, const Contract::Alias*>& aliases, const Contract::Action& a) {
+	gatherAliases(ret, aliases, a.args);
+}
+
+static inline void gatherAliases(std::set<std::string>& ret, const std::map<std::string, const Contract::Alias*>& aliases, const Contract::Alias& a) {
+	gatherAliases(ret, aliases, a.type);
+}
+
+static inline void gatherAliases(std::set<std::string>& ret, const std::map<std::string, const Contract::Alias*>& aliases, const Contract::Session& s)
+{
+	for(const auto& i: s.items)
+	{
+		std::visit([&ret, &aliases](const auto& i){ gatherAliases(ret, aliases, i); }, i.second);
+	}
+}
+
+/*
+ * Serializes the item along with the definitions of all the types it depends on.
+ */
+static inline std::string itemFingerprint(const Contract& c, const std::map<std::string, const Contract::Alias*>& aliases, const Contract::Item& item)
+{
+	std::set<std::string> deps;
+	std::visit([&deps, &aliases](const auto& i){ gatherAliases(deps, aliases, i); }, item.second);
+
+	std::vector<Contract::Item> items;
+	for(const auto& i: c.items)
+	{
+		if(auto a = std::get_if<Contract::Alias>(&i.second); a && deps.count(a->name))
+		{
+			items.push_back(i);
+		}
+	}
+
+	items.push_back(item);
+	return serializeText({Contract{std::move(items), c.name, {}, c.annotations}});
+}
+
+std::vector<std::string> renderItems(const GenContext& ctx, const Contract& c, const std::string& section, const ItemRenderer& f)
+{
+	std::vector<std::string> ret;
+
+	if(!ctx.cache)
+	{
+		for(const auto& i: c.items)
+		{
+			f(ret, i);
+		}
+
+		return ret;
+	}
+
+	std::map<std::string, const Contract::Alias*> aliases;
+	for(const auto& i: c.items)
+	{
+		if(auto a = std::get_if<Contract::Alias>(&i.second))
+		{
+			aliases.emplace(a->name, a);
+		}
+	}
+
+	const auto prefix = contentHash(ctx.opts.fingerprint() + '\0', contentHash(section + '\0'));
+
+	for(const auto& i: c.items)
+	{
+		const auto& strs = ctx.cache->get(contentHash(itemFingerprint(c, aliases, i), prefix), [&f, &i]()
+		{
+			std::vector<std::string> ret;
+			f(ret, i);
+			return ret;
+		});
+
+		std::copy(strs.begin(), strs.end(), std::back_inserter(ret));
+	}
+
+	return ret;
+}
+
+using TypePredicate = std::function<bool(const Contract::TypeDef&)>;
+
+static inline bool usesType(const Contract::TypeDef& t, const TypePredicate& p);
+
+static inline bool usesType(const Contract::TypeRef& t, const TypePredicate& p) {
+	return std::visit([&p](const auto& t){ return usesType(Contract::TypeDef{t}, p); }, t);
+}
+
+static inline bool usesType(const std::vector<Contract::Var>& vs, const TypePredicate& p) {
+	return std::any_of(vs.begin(), vs.end(), [&p](const auto& v){ return usesType(v.type, p); });
+}
+
+static inline bool usesType(const Contract::TypeDef& t, const TypePredicate& p)
+{
+	if(p(t))
+	{
+		return true;
+	}
+	else if(auto c = std::get_if<Contract::Collection>(&t))
+	{
+		return usesType(*c->elementType, p);
+	}
+	else if(auto r = std::get_if<Contract::Array>(&t))
+	{
+		return usesType(*r->elementType, p);
+	}
+	else if(auto a = std::get_if<Contract::Aggregate>(&t))
+	{
+		return usesType(a->members, p);
+	}
+
+	return false;
+}
+
+static inline bool usesType(const Contract::Function& f, const TypePredicate& p) {
+	return usesType(f.args, p) || (f.returnType && usesType(*f.returnType, p));
+}
+
+static inline bool usesType(const Contract::Action& a, const TypePredicate& p) {
+	return usesType(a.args, p);
+}
+
+static inline bool usesType(const Contract::Alias& a, const TypePredicate& p) {
+	return usesType(a.type, p);
+}
+
+static inline bool usesType(const Contract::Session& s, const TypePredicate& p)
+{
+	return std::any_of(s.items.begin(), s.items.end(), [&p](const auto& i){
+		return std::visit([&p](const auto& i){ return usesType(i, p); }, i.second);
+	});
+}
+
+bool usesType(const Contract& c, const TypePredicate& p)
+{
+	return std::any_of(c.items.begin(), c.items.end(), [&p](const auto& i){
+		return std::visit([&p](const auto& i){ return usesType(i, p); }, i.second);
+	});
+}
@@ -2,10 +2,12 @@
 #define RPC_TOOL_GEN_CPP_CPPCOMMON_H_
 
 #include "ast/Contract.h"
+#include "gen/Generator.h"
 
 #include <string>
 #include <vector>
 #include <sstream>
+#include <functional>
 
 #include <cassert>
 #include <cctype>
@@ -18,7 +20,13 @@ namespace detail
 	static constexpr auto contractNsSuffix = "Contract";
 	static constexpr auto parametricNsSuffix = "Parametric";
 	static constexpr auto typeNsSuffix = "Types";
+	static constexpr auto viewNsSuffix = "Views";
+	static constexpr auto arenaNsSuffix = "ArenaTypes";
+	static constexpr auto columnNsSuffix = "Columns";
 	static constexpr auto symNsSuffix = "Symbols";
+	static constexpr auto sizeNsSuffix = "WireSizes";
+	static constexpr auto accessorNsSuffix = "Accessors";
+	static constexpr auto builderNsSuffix = "Builders";
 	static constexpr auto actSgnTypeSuffix = "Call";
 	static constexpr auto funSgnTypeSuffix = "Function";
 	static constexpr auto cbSgnTypeSuffix = "Callback";
@@ -30,6 +38,7 @@ namespace detail
 	static constexpr auto sessFwdExportTypeSuffix = "CallExports";
 	static constexpr auto sessBwdExportTypeSuffix = "CallbackExports";
 	static constexpr auto clientProxySuffix = "ClientProxy";
+	static constexpr auto clientLinksSuffix = "ClientLinks";
 	static constexpr auto serverProxySuffix = "ServerProxy";
 	static constexpr auto clientSessionSuffix = "ClientSession";
 	static constexpr auto serverSessionSuffix = "ServerSession";
@@ -55,6 +64,32 @@ namespace detail
 	}
 }
 
+class RenderCache;
+
+/// State shared by the sub-generators while generating a single output.
+struct GenContext
+{
+	const CodeGen::Options& opts;
+	RenderCache* const cache;
+};
+
+/// Prefix for the declarations that need to be visible to the importers of a module.
+static inline std::string exportKeyword(const GenContext& ctx) {
+	return ctx.opts.module ? "export " : "";
+}
+
+using ItemRenderer = std::function<void(std::vector<std::string>&, const Contract::Item&)>;
+
+/*
+ * Collects the snippets rendered by the specified function for every item of the contract,
+ * taking them from the render cache instead if the item (including the definitions of the
+ * types it refers to) did not change since it was last rendered for the same section.
+ */
+std::vector<std::string> renderItems(const GenContext& ctx, const Contract& c, const std::string& section, const ItemRenderer& f);
+
+/// Whether any type spelled out in the contract (at any depth, without following aliases) satisfies the predicate.
+bool usesType(const Contract& c, const std::function<bool(const Contract::TypeDef&)>& p);
+
 inline std::string indent(const int n) {
 	return std::string(n * detail::indentStep, ' ');
 }
@@ -63,6 +98,17 @@ bool writeBlock(std::stringstream& ss, const std::string &header, const std::vec
 
 void writeTopLevelBlock(std::stringstream& ss, const std::string &header, const std::vector<std::string>& strs, bool addSemi = true);
 
+/// Bounded collections are stored inline (regardless of the collection template used otherwise).
+static inline std::string boundedCollection(const Contract::Collection& c, const std::string& unbounded, const std::string& element)
+{
+	if(c.capacity)
+	{
+		return "rpc::InlineMany<" + element + ", " + std::to_string(*c.capacity) + ">";
+	}
+
+	return unbounded + "<" + element + ">";
+}
+
 static inline std::string cppPrimitive(Contract::Primitive p)
 {
 	switch(p)
@@ -76,10 +122,16 @@ static inline std::string cppPrimitive(Contract::Primitive p)
 	case Contract::Primitive::U4: return "uint32_t";
 	case Contract::Primitive::I8: return "int64_t";
 	case Contract::Primitive::U8: return "uint64_t";
+	case Contract::Primitive::String: return "std::string_view";
 	default: throw std::runtime_error("unknown primitive type: " + std::to_string((int)p));
 	}
 }
 
+/// Strings are stored as the kind of string that goes with the collection template (owning or a view of the receive buffer).
+static inline std::string storedPrimitive(Contract::Primitive p, const std::string& collection) {
+	return (p == Contract::Primitive::String) ? ("rpc::String<" + collection + ">") : cppPrimitive(p);
+}
+
 static inline auto contractRootBlockName(const std::string& contractName) {
 	return detail::capitalize(contractName) + detail::contractNsSuffix;
 }
@@ -92,6 +144,30 @@ static inline auto contractTypeBlockNameRef(const std::string& contractName) {
 	return contractRootBlockName(contractName) + "::" + contractTypeBlockNameDef(contractName);
 }
 
+static inline auto contractViewBlockNameDef(const std::string& contractName) {
+	return detail::viewNsSuffix;
+}
+
+static inline auto contractViewBlockNameRef(const std::string& contractName) {
+	return contractRootBlockName(contractName) + "::" + contractViewBlockNameDef(contractName);
+}
+
+static inline auto contractArenaBlockNameDef(const std::string& contractName) {
+	return detail::arenaNsSuffix;
+}
+
+static inline auto contractArenaBlockNameRef(const std::string& contractName) {
+	return contractRootBlockName(contractName) + "::" + contractArenaBlockNameDef(contractName);
+}
+
+static inline auto contractColumnBlockNameDef(const std::string& contractName) {
+	return detail::columnNsSuffix;
+}
+
+static inline auto contractColumnBlockNameRef(const std::string& contractName) {
+	return contractRootBlockName(contractName) + "::" + contractColumnBlockNameDef(contractName);
+}
+
 static inline auto contractParametricBlockNameDef(const std::string& contractName) {
 	return detail::parametricNsSuffix;
 }
@@ -108,6 +184,30 @@ static inline auto contractSymbolsBlockNameRef(const std::string& contractName)
 	return contractRootBlockName(contractName) + "::" + contractSymbolsBlockNameDef(contractName);
 }
 
+static inline auto contractWireSizesBlockNameDef(const std::string& contractName) {
+	return detail::sizeNsSuffix;
+}
+
+static inline auto contractWireSizesBlockNameRef(const std::string& contractName) {
+	return contractRootBlockName(contractName) + "::" + contractWireSizesBlockNameDef(contractName);
+}
+
+static inline auto contractAccessorBlockNameDef(const std::string& contractName) {
+	return detail::accessorNsSuffix;
+}
+
+static inline auto contractAccessorBlockNameRef(const std::string& contractName) {
+	return contractRootBlockName(contractName) + "::" + contractAccessorBlockNameDef(contractName);
+}
+
+static inline auto contractBuilderBlockNameDef(const std::string& contractName) {
+	return detail::builderNsSuffix;
+}
+
+static inline auto contractBuilderBlockNameRef(const std::string& contractName) {
+	return contractRootBlockName(contractName) + "::" + contractBuilderBlockNameDef(contractName);
+}
+
 static inline auto contractClientProxyNameDef(const std::string& contractName) {
 	return detail::clientProxySuffix;
 }
@@ -116,6 +216,14 @@ static inline auto contractClientProxyNameRef(const std::string& contractName) {
 	return contractRootBlockName(contractName) + "::" + contractClientProxyNameDef(contractName);
 }
 
+static inline auto contractClientLinksNameDef(const std::string& contractName) {
+	return detail::clientLinksSuffix;
+}
+
+static inline auto contractClientLinksNameRef(const std::string& contractName) {
+	return contractRootBlockName(contractName) + "::" + contractClientLinksNameDef(contractName);
+}
+
 static inline auto contractServerProxyNameDef(const std::string& contractName) {
 	return detail::serverProxySuffix;
 }
@@ -0,0 +1,94 @@
+#include "CppInstantiationGen.h"
+
+#include "CppCommon.h"
+
+#include <set>
+
+/*
+ * Spells out the rpc::Many specializations of the types owned by the contract (aggregates,
+ * session exports and their serializers), the same ones for the extern template declarations
+ * of the header and for the explicit instantiations of the companion unit. The call signatures
+ * are specializations of a runtime template that any number of contracts may share, so defining
+ * them in the unit of each could clash, and declaring them extern without a definition would
+ * leave them undefined; they are instantiated implicitly wherever they are used instead.
+ */
+struct InstantiationGenerator
+{
+	const std::string pName;
+
+	inline void addStruct(std::vector<std::string> &r, const std::string& type) const
+	{
+		r.push_back(type);
+		r.push_back("rpc::TypeInfo<" + type + ">");
+	}
+
+	void handleItem(std::vector<std::string> &r, const Contract::Alias &a) const
+	{
+		if(std::holds_alternative<Contract::Aggregate>(a.type))
+		{
+			addStruct(r, pName + "::" + userTypeName(a.name) + "<rpc::Many>");
+		}
+	}
+
+	void handleItem(std::vector<std::string> &, const Contract::Function &) const {}
+
+	void handleItem(std::vector<std::string> &r, const Contract::Session &s) const
+	{
+		const auto sName = pName + "::" + sessionNamespaceName(s.name);
+		addStruct(r, sName + "::" + sessionCallExportTypeName(s.name) + "<rpc::Many>");
+		addStruct(r, sName + "::" + sessionCallbackExportTypeName(s.name) + "<rpc::Many>");
+	}
+};
+
+static inline std::vector<std::string> instantiatedTypes(const Contract& c, const GenContext& ctx)
+{
+	const InstantiationGenerator gen{contractParametricBlockNameRef(c.name)};
+
+	const auto strs = renderItems(ctx, c, "instantiations", [&gen](auto& r, const auto& i){
+		std::visit([&r, &gen](const auto& i){ gen.handleItem(r, i); }, i.second);
+	});
+
+	std::set<std::string> seen;
+	std::vector<std::string> ret;
+
+	for(const auto& s: strs)
+	{
+		if(seen.insert(s).second)
+		{
+			ret.push_back(s);
+		}
+	}
+
+	return ret;
+}
+
+void writeExternTemplates(std::stringstream &ss, const Contract& c, const GenContext& ctx)
+{
+	const auto types = instantiatedTypes(c, ctx);
+
+	for(const auto& t: types)
+	{
+		ss << "extern template struct " << t << ";" << std::endl;
+	}
+
+	if(types.size())
+	{
+		ss << std::endl;
+	}
+}
+
+void writeExplicitInstantiations(std::stringstream &ss, const std::vector<Contract>& cs, const GenContext& ctx)
+{
+	std::set<std::string> seen;
+
+	for(const auto& c: cs)
+	{
+		for(const auto& t: instantiatedTypes(c, ctx))
+		{
+			if(seen.insert(t).second)
+			{
+				ss << "template struct " << t << ";" << std::endl;
+			}
+		}
+	}
+}
@@ -0,0 +1,13 @@
+#ifndef RPC_TOOL_GEN_CPP_CPPINSTANTIATIONGEN_H_
+#define RPC_TOOL_GEN_CPP_CPPINSTANTIATIONGEN_H_
+
+#include "ast/Contract.h"
+
+#include <sstream>
+
+struct GenContext;
+
+void writeExternTemplates(std::stringstream &ss, const Contract& c, const GenContext& ctx);
+void writeExplicitInstantiations(std::stringstream &ss, const std::vector<Contract>& cs, const GenContext& ctx);
+
+#endif /* RPC_TOOL_GEN_CPP_CPPINSTANTIATIONGEN_H_ */
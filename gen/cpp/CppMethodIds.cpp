@@ -0,0 +1,141 @@
+#include "CppMethodIds.h"
+
+#include "ast/ContentHash.h"
+
+#include <algorithm>
+#include <map>
+
+std::string MethodIds::structure(const Contract::Primitive& p, std::vector<std::string>&) const {
+	return Contract::mapPrimitive(p);
+}
+
+std::string MethodIds::structure(const Contract::Collection& c, std::vector<std::string>& path) const {
+	// The capacity is part of the structure, peers with differing limits would reject each other's data.
+	return "[" + std::visit([this, &path](const auto& t){ return structure(t, path); }, *c.elementType) + (c.capacity ? ";<=" + std::to_string(*c.capacity) : std::string{}) + "]";
+}
+
+std::string MethodIds::structure(const Contract::Array& a, std::vector<std::string>& path) const {
+	return "[" + std::visit([this, &path](const auto& t){ return structure(t, path); }, *a.elementType) + ";" + std::to_string(a.length) + "]";
+}
+
+std::string MethodIds::structure(const Contract::Aggregate& a, std::vector<std::string>& path) const
+{
+	std::string ret = "{";
+
+	for(const auto& g: layout.groups(a))
+	{
+		ret += (g.first ? "," : "");
+
+		// Packed flags change the wire format, so they are distinguished from plain bools.
+		if(g.flags)
+		{
+			ret += "bits" + std::to_string(g.count);
+		}
+		else
+		{
+			ret += value(a.members[g.first].type, path);
+		}
+	}
+
+	return ret + "}";
+}
+
+std::string MethodIds::structure(const std::string& n, std::vector<std::string>& path) const
+{
+	const auto d = layout.definition(n);
+
+	if(!d || std::find(path.begin(), path.end(), n) != path.end())
+	{
+		return n;
+	}
+
+	path.push_back(n);
+	const auto ret = std::visit([this, &path](const auto& t){ return structure(t, path); }, *d);
+	path.pop_back();
+	return ret;
+}
+
+/// Varint encoded values are marked, as they are different on the wire.
+std::string MethodIds::value(const Contract::TypeRef& t, std::vector<std::string>& path) const {
+	return (layout.isVarint(t) ? "~" : "") + std::visit([this, &path](const auto& t){ return structure(t, path); }, t);
+}
+
+std::string MethodIds::structure(const Contract::Action& a) const
+{
+	std::vector<std::string> path;
+	std::string ret = "(";
+
+	for(auto i = 0u; i < a.args.size(); i++)
+	{
+		ret += (i ? "," : "") + value(a.args[i].type, path);
+	}
+
+	return ret + ")";
+}
+
+std::string MethodIds::structure(const Contract::Function& f) const
+{
+	std::vector<std::string> path;
+	return structure((const Contract::Action&)f) + (f.returnType ? ":" + value(*f.returnType, path) : "");
+}
+
+uint32_t MethodIds::id(const std::string& name, const std::string& structure) const
+{
+	const auto h = contentHash(structure, contentHash(name + '\0', contentHash(cName + '\0')));
+	return (uint32_t)(h ^ (h >> 32));
+}
+
+uint32_t MethodIds::id(const Contract::Function &f) const {
+	return id(f.name, structure(f));
+}
+
+uint32_t MethodIds::id(const Contract::Session &s, const Contract::Session::Ctor &c) const
+{
+	// The exported calls are part of the structure of a session constructor, as they are passed along.
+	std::string exports;
+
+	for(const auto& i: s.items)
+	{
+		if(auto f = std::get_if<Contract::Session::ForwardCall>(&i.second))
+		{
+			exports += "!" + structure(*f);
+		}
+		else if(auto cb = std::get_if<Contract::Session::CallBack>(&i.second))
+		{
+			exports += "@" + structure(*cb);
+		}
+	}
+
+	return id(s.name + "::" + c.name, structure(c) + "<" + exports + ">");
+}
+
+MethodIds::MethodIds(const Contract& c): cName(c.name), layout(c)
+{
+	std::map<uint32_t, std::string> ids;
+
+	const auto add = [&ids, this](const uint32_t id, const std::string& name)
+	{
+		if(auto it = ids.emplace(id, name); !it.second)
+		{
+			throw std::runtime_error("methods '" + it.first->second + "' and '" + name + "' of contract '" + cName + "' have the same numeric identifier");
+		}
+	};
+
+	for(const auto& i: c.items)
+	{
+		if(auto f = std::get_if<Contract::Function>(&i.second))
+		{
+			add(id(*f), f->name);
+		}
+		else if(auto s = std::get_if<Contract::Session>(&i.second))
+		{
+			for(const auto& j: s->items)
+			{
+				if(auto ctor = std::get_if<Contract::Session::Ctor>(&j.second))
+				{
+					add(id(*s, *ctor), s->name + "::" + ctor->name);
+				}
+			}
+		}
+	}
+}
@@ -0,0 +1,36 @@
+#ifndef RPC_TOOL_GEN_CPP_CPPMETHODIDS_H_
+#define RPC_TOOL_GEN_CPP_CPPMETHODIDS_H_
+
+#include "CppWireLayout.h"
+
+#include <cstdint>
+
+/*
+ * Derives the numeric identifiers of the methods from the name of the contract, the name of the
+ * method and its structure on the wire (aliases substituted, argument and member names omitted).
+ */
+class MethodIds
+{
+	const std::string cName;
+	const WireLayout layout;
+
+	std::string structure(const Contract::Primitive& p, std::vector<std::string>& path) const;
+	std::string structure(const Contract::Collection& c, std::vector<std::string>& path) const;
+	std::string structure(const Contract::Array& a, std::vector<std::string>& path) const;
+	std::string structure(const Contract::Aggregate& a, std::vector<std::string>& path) const;
+	std::string structure(const std::string& n, std::vector<std::string>& path) const;
+	std::string value(const Contract::TypeRef& t, std::vector<std::string>& path) const;
+	std::string structure(const Contract::Action& a) const;
+	std::string structure(const Contract::Function& f) const;
+
+	uint32_t id(const std::string& name, const std::string& structure) const;
+
+public:
+	/// Fails if there are methods with clashing identifiers in the contract.
+	MethodIds(const Contract& c);
+
+	uint32_t id(const Contract::Function &f) const;
+	uint32_t id(const Contract::Session &s, const Contract::Session::Ctor &c) const;
+};
+
+#endif /* RPC_TOOL_GEN_CPP_CPPMETHODIDS_H_ */
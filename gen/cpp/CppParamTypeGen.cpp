@@ -1,25 +1,52 @@
 #include "CppParamTypeGen.h"
 
 #include "CppCommon.h"
+#include "CppWireLayout.h"
 
 #include <algorithm>
 #include <list>
 
 struct CommonTypeGenerator
 {
+	struct Mode
+	{
+		const WireLayout& layout;
+		bool packed, reorder;
+	};
+
 	static inline std::string handleTypeRef(const std::string &n) { return userTypeName(n) + "<Collection>"; }
-	static inline std::string handleTypeRef(const Contract::Primitive& p) { return cppPrimitive(p); }
+	static inline std::string handleTypeRef(const Contract::Primitive& p) { return storedPrimitive(p, "Collection"); }
 
 	static inline std::string handleTypeRef(const Contract::Collection &c) {
-		return "Collection<" + std::visit([](const auto& e){return handleTypeRef(e);}, *c.elementType) + ">";
+		return boundedCollection(c, "Collection", std::visit([](const auto& e){return handleTypeRef(e);}, *c.elementType));
+	}
+
+	static inline std::string handleTypeRef(const Contract::Array &a) {
+		return "std::array<" + std::visit([](const auto& e){return handleTypeRef(e);}, *a.elementType) + ", " + std::to_string(a.length) + ">";
 	}
 
-	static inline std::string handleTypeDef(const std::string& name, const Contract::Aggregate& a, const int n)
+	static inline std::string handleTypeDef(const std::string& name, const Contract::Aggregate& a, const Mode& mode, const int n)
 	{
+		// Fixed size aggregates are laid out exactly as on the wire, so that they can be copied in bulk.
+		const bool packed = mode.packed && mode.layout.trivialSize(a);
+
+		std::vector<const Contract::Var*> members;
+		std::transform(a.members.begin(), a.members.end(), std::back_inserter(members), [](const auto& v){ return &v; });
+
+		// The serializer refers to the members by name, so they can be stored in any order.
+		if(mode.reorder && !packed)
+		{
+			std::stable_sort(members.begin(), members.end(), [&mode](const auto* x, const auto* y){
+				return std::visit([&mode](const auto& t){ return mode.layout.alignment(t); }, x->type)
+					> std::visit([&mode](const auto& t){ return mode.layout.alignment(t); }, y->type);
+			});
+		}
+
 		std::vector<std::string> result;
 
-		for(const auto& v: a.members)
+		for(const auto* m: members)
 		{
+			const auto& v = *m;
 			std::stringstream ss;
 			ss << printDocs(v.docs, n + 1);
 			ss << indent(n + 1) << std::visit([](const auto& i){ return handleTypeRef(i); }, v.type);
@@ -27,35 +54,46 @@ struct CommonTypeGenerator
 			result.push_back(ss.str());
 		}
 
+		const std::string attrs = packed ? "[[gnu::packed]] " : "";
+		const auto header = "template<template<class> class Collection> struct " + attrs + userTypeName(name);
+
 		std::stringstream ss;
-		writeBlock(ss, "template<template<class> class Collection> struct " + userTypeName(name), result, n);
+
+		if(!writeBlock(ss, header, result, n))
+		{
+			ss << indent(n) << header << " {}";
+		}
+
 		return ss.str();
 	}
 
 	template<class T>
-	static inline std::string handleTypeDef(const std::string& name, const T& t, const int n)
+	static inline std::string handleTypeDef(const std::string& name, const T& t, const Mode&, const int n)
 	{
 		std::stringstream ss;
 		ss << indent(n) << "template<template<class> class Collection> using " << userTypeName(name) << " = " << handleTypeRef(t);
 		return ss.str();
 	}
 
-	static inline std::string handleItem(const Contract::Alias &a, const int n) {
-		return std::visit([name{a.name}, n](const auto &t){ return handleTypeDef(name, t, n); }, a.type) + ";";
+	static inline std::string handleItem(const Contract::Alias &a, const Mode& mode, const int n) {
+		return std::visit([name{a.name}, &mode, n](const auto &t){ return handleTypeDef(name, t, mode, n); }, a.type) + ";";
 	}
 
-	static inline std::array<std::string, 2> toSgnArg(const Contract::Var& a) {
-		return {argumentName(a.name), std::visit([](const auto& t){return handleTypeRef(t);}, a.type)};
+	/// Varint encoded values are marked in the signature, so that the runtime picks the encoding for them.
+	static inline std::array<std::string, 2> toSgnArg(const Contract::Var& a, const Mode& mode)
+	{
+		const auto type = std::visit([](const auto& t){return handleTypeRef(t);}, a.type);
+		return {argumentName(a.name), mode.layout.isVarint(a.type) ? ("rpc::Varint<" + type + ">") : type};
 	}
 
-	static inline std::vector<std::array<std::string, 2>> toSignArgList(const std::vector<Contract::Var>& args)
+	static inline std::vector<std::array<std::string, 2>> toSignArgList(const std::vector<Contract::Var>& args, const Mode& mode)
 	{
 		std::vector<std::array<std::string, 2>> ret;
-		std::transform(args.begin(), args.end(), std::back_inserter(ret), toSgnArg);
+		std::transform(args.begin(), args.end(), std::back_inserter(ret), [&mode](const auto& a){ return toSgnArg(a, mode); });
 		return ret;
 	}
 
-	static inline std::string signature(const std::string &name, const decltype(toSignArgList({})) &args, const int n)
+	static inline std::string signature(const std::string &name, const std::vector<std::array<std::string, 2>> &args, const int n)
 	{
 		std::stringstream ss;
 		ss << indent(n) << "template<template<class> class Collection> using " << name << " = rpc::Call";
@@ -94,14 +132,14 @@ struct CommonTypeGenerator
 		return ss.str();
 	}
 
-	static inline std::string handleItem(const Contract::Function &f, const int n)
+	static inline std::string handleItem(const Contract::Function &f, const Mode& mode, const int n)
 	{
 		std::stringstream ss;
 		if(f.returnType)
 		{
 			std::string cbTypeName = callbackSignatureTypeName(f.name);
-			ss << signature(cbTypeName, {toSgnArg({"retval", *f.returnType, ""})}, n) << std::endl;
-			auto args = toSignArgList(f.args);
+			ss << signature(cbTypeName, {toSgnArg({"retval", *f.returnType, ""}, mode)}, n) << std::endl;
+			auto args = toSignArgList(f.args, mode);
 			args.push_back({"callback", cbTypeName + "<Collection>"});
 			const auto type = functionSignatureTypeName(f.name);
 			ss << signature(type, args, n);
@@ -109,7 +147,7 @@ struct CommonTypeGenerator
 		else
 		{
 			const auto type = actionSignatureTypeName(f.name);
-			ss << signature(type, toSignArgList(f.args), n);
+			ss << signature(type, toSignArgList(f.args, mode), n);
 		}
 
 		return ss.str();
@@ -119,29 +157,29 @@ struct CommonTypeGenerator
 		std::vector<std::array<std::string, 2>> fwd, bwd;
 	};
 
-	static inline std::string handleSessionItemInitial(SessionCalls &calls, const std::string& docs, const Contract::Session::Ctor &c, const int n) { return {}; }
+	static inline std::string handleSessionItemInitial(SessionCalls &calls, const std::string& docs, const Contract::Session::Ctor &c, const Mode&, const int n) { return {}; }
 
-	static inline std::string handleSessionItemInitial(SessionCalls &calls, const std::string& docs, const Contract::Session::ForwardCall &f, const int n)
+	static inline std::string handleSessionItemInitial(SessionCalls &calls, const std::string& docs, const Contract::Session::ForwardCall &f, const Mode& mode, const int n)
 	{
 		std::stringstream ss;
 		ss << printDocs(docs, n);
 		const auto typeName = sessionForwardCallSignatureTypeName(f.name);
-		ss << signature(typeName, toSignArgList(f.args), n);
+		ss << signature(typeName, toSignArgList(f.args, mode), n);
 		calls.fwd.push_back({f.name, typeName});
 		return ss.str();
 	}
 
-	static inline std::string handleSessionItemInitial(SessionCalls &calls, const std::string& docs, const Contract::Session::CallBack & cb, const int n)
+	static inline std::string handleSessionItemInitial(SessionCalls &calls, const std::string& docs, const Contract::Session::CallBack & cb, const Mode& mode, const int n)
 	{
 		std::stringstream ss;
 		ss << printDocs(docs, n);
 		const auto typeName = sessionCallbackSignatureTypeName(cb.name);
-		ss << signature(typeName, toSignArgList(cb.args), n);
+		ss << signature(typeName, toSignArgList(cb.args, mode), n);
 		calls.bwd.push_back({cb.name, typeName});
 		return ss.str();
 	}
 
-	static inline std::string handleSessionItemFinal(const std::string& sName, const std::string& docs, const Contract::Session::Ctor & c, const int n)
+	static inline std::string handleSessionItemFinal(const std::string& sName, const std::string& docs, const Contract::Session::Ctor & c, const Mode& mode, const int n)
 	{
 		std::stringstream ss;
 		ss << printDocs(docs, n);
@@ -149,14 +187,14 @@ struct CommonTypeGenerator
 		std::vector<std::array<std::string, 2>> bwdArgs;
 		if(c.returnType)
 		{
-			bwdArgs.push_back(toSgnArg({"_retval", *c.returnType, ""}));
+			bwdArgs.push_back(toSgnArg({"_retval", *c.returnType, ""}, mode));
 		}
 
 		bwdArgs.push_back({"_exports", sessionCallExportTypeName(sName) + "<Collection>"});
 
 		ss << signature(sessionAcceptSignatureTypeName(c.name), bwdArgs, n) << std::endl;
 
-		auto fwdArgs = toSignArgList(c.args);
+		auto fwdArgs = toSignArgList(c.args, mode);
 		fwdArgs.push_back({"_exports", sessionCallbackExportTypeName(sName) + "<Collection>"});
 		fwdArgs.push_back({"_accept", sessionAcceptSignatureTypeName(c.name) + "<Collection>"});
 
@@ -165,8 +203,8 @@ struct CommonTypeGenerator
 		return ss.str();
 	}
 
-	static inline std::string handleSessionItemFinal(const std::string& sName, const std::string& docs, const Contract::Session::ForwardCall&, const int n) { return {}; }
-	static inline std::string handleSessionItemFinal(const std::string& sName, const std::string& docs, const Contract::Session::CallBack&, const int n) { return {}; }
+	static inline std::string handleSessionItemFinal(const std::string& sName, const std::string& docs, const Contract::Session::ForwardCall&, const Mode&, const int n) { return {}; }
+	static inline std::string handleSessionItemFinal(const std::string& sName, const std::string& docs, const Contract::Session::CallBack&, const Mode&, const int n) { return {}; }
 
 	static inline std::string sessionExports(const std::string& name, const std::vector<std::array<std::string, 2>> &d, const int n)
 	{
@@ -188,21 +226,21 @@ struct CommonTypeGenerator
 		return ss.str();
 	}
 
-	static inline std::string handleItem(const Contract::Session &s, const int n)
+	static inline std::string handleItem(const Contract::Session &s, const Mode& mode, const int n)
 	{
 		std::vector<std::string> result;
 
 		SessionCalls scs;
 
 		for(const auto& it: s.items) {
-			result.push_back(std::visit([&scs, n, docs{it.first}](const auto& i){ return handleSessionItemInitial(scs, docs, i, n + 1); }, it.second));
+			result.push_back(std::visit([&scs, &mode, n, docs{it.first}](const auto& i){ return handleSessionItemInitial(scs, docs, i, mode, n + 1); }, it.second));
 		}
 
 		result.push_back(sessionExports(sessionCallExportTypeName(s.name), scs.fwd, n + 1));
 		result.push_back(sessionExports(sessionCallbackExportTypeName(s.name), scs.bwd, n + 1));
 
 		for(const auto& it: s.items) {
-			result.push_back(std::visit([&s, n, docs{it.first}](const auto& i){ return handleSessionItemFinal(s.name, docs, i, n + 1); }, it.second));
+			result.push_back(std::visit([&s, &mode, n, docs{it.first}](const auto& i){ return handleSessionItemFinal(s.name, docs, i, mode, n + 1); }, it.second));
 		}
 
 		std::stringstream ss;
@@ -212,16 +250,18 @@ struct CommonTypeGenerator
 	}
 };
 
-void writeParametricContractTypes(std::stringstream &ss, const Contract& c)
+void writeParametricContractTypes(std::stringstream &ss, const Contract& c, const GenContext& ctx)
 {
-	std::vector<std::string> result;
-	for(const auto& i: c.items)
+	const WireLayout layout(c);
+	const CommonTypeGenerator::Mode mode{layout, ctx.opts.packed, ctx.opts.reorderMembers};
+
+	const auto result = renderItems(ctx, c, "parametric", [&mode](auto& r, const auto& i)
 	{
 		std::stringstream ss;
 		ss << printDocs(i.first, 1);
-		ss << std::visit([](const auto& i){ return CommonTypeGenerator::handleItem(i, 1); }, i.second);
-		result.push_back(ss.str());
-	}
+		ss << std::visit([&mode](const auto& i){ return CommonTypeGenerator::handleItem(i, mode, 1); }, i.second);
+		r.push_back(ss.str());
+	});
 
 	writeTopLevelBlock(ss, printDocs(c.docs, 0) + "struct " + contractParametricBlockNameRef(c.name), result);
 }
@@ -5,6 +5,8 @@
 
 #include <sstream>
 
-void writeParametricContractTypes(std::stringstream &ss, const Contract& c);
+struct GenContext;
+
+void writeParametricContractTypes(std::stringstream &ss, const Contract& c, const GenContext& ctx);
 
 #endif /* RPC_TOOL_GEN_CPP_CPPTYPEGEN_H_ */
@@ -3,7 +3,9 @@
 
 #include "CppCommon.h"
 
-static inline std::string cppTypeRef(const Contract::Primitive& p, const std::string& cName) { return cppPrimitive(p); }
+static inline std::string cppTypeRef(const Contract::Primitive& p, const std::string& cName) {
+	return (p == Contract::Primitive::String) ? "rpc::StringPlaceholder" : cppPrimitive(p);
+}
 
 static inline std::string cppTypeRef(const std::string &n, const std::string& cName) {
 	return contractTypeBlockNameRef(cName) + "::" + userTypeName(n);
@@ -13,18 +15,129 @@ static inline std::string cppTypeRef(const Contract::Collection &c, const std::s
 	return "rpc::CollectionPlaceholder<" + std::visit([&cName](const auto& e){ return cppTypeRef(e, cName); }, *c.elementType) + ">";
 }
 
+static inline std::string cppTypeRef(const Contract::Array &a, const std::string& cName) {
+	return "std::array<" + std::visit([&cName](const auto& e){ return cppTypeRef(e, cName); }, *a.elementType) + ", " + std::to_string(a.length) + ">";
+}
+
 static inline std::string refTypeRef(const Contract::Primitive& p) { return Contract::mapPrimitive(p); }
 static inline std::string refTypeRef(const std::string &n) { return n; }
 
 static inline std::string refTypeRef(const Contract::Collection &c) {
-	return "[" + std::visit([](const auto& e){ return refTypeRef(e); }, *c.elementType) + "]";
+	return "[" + std::visit([](const auto& e){ return refTypeRef(e); }, *c.elementType) + (c.capacity ? "; <=" + std::to_string(*c.capacity) : std::string{}) + "]";
+}
+
+static inline std::string refTypeRef(const Contract::Array &a) {
+	return "[" + std::visit([](const auto& e){ return refTypeRef(e); }, *a.elementType) + "; " + std::to_string(a.length) + "]";
+}
+
+static inline std::string compatibility(const std::string& tName, const std::string& uName) {
+	return "rpc::isCompatible<" + tName + ", " + uName + ">()";
 }
 
 static inline std::string argCheck(const std::string& tName, const std::string& uName, const std::string &message, const int n)
 {
 	std::stringstream ss;
-	ss << indent(n) << "static_assert(rpc::isCompatible<" << tName << ", " << uName << ">(), \"" << message << "\");" << std::endl;
+	ss << indent(n) << "static_assert(" << compatibility(tName, uName) << ", \"" << message << "\");" << std::endl;
 	return ss.str();
 }
 
+/// Single assertion covering all the conditions (used by the lean generation mode).
+static inline std::string aggregateCheck(const std::vector<std::string>& conds, const std::string &message, const int n)
+{
+	std::stringstream ss;
+
+	if(conds.size())
+	{
+		ss << indent(n) << "static_assert(";
+
+		for(auto i = 0u; i < conds.size(); i++)
+		{
+			ss << (i ? " && " : "") << conds[i];
+		}
+
+		ss << ", \"" << message << "\");" << std::endl;
+	}
+
+	return ss.str();
+}
+
+/*
+ * Parameters of a proxy method in lean mode: primitives are taken by value through concretely
+ * typed parameters (strings as a view), only the rest needs to be a template parameter with a
+ * compatibility check.
+ */
+struct LeanArgs
+{
+	std::vector<std::string> templateParams, params, forwards, conds;
+
+	inline LeanArgs(const std::vector<Contract::Var>& args, const std::string& cName)
+	{
+		for(auto i = 0u; i < args.size(); i++)
+		{
+			const auto cppType = std::visit([&cName](const auto& t){ return cppTypeRef(t, cName); }, args[i].type);
+			const auto name = argumentName(args[i].name);
+
+			if(auto p = std::get_if<Contract::Primitive>(&args[i].type))
+			{
+				params.push_back(cppPrimitive(*p) + " " + name);
+				forwards.push_back(name);
+			}
+			else
+			{
+				const auto tName = "A" + std::to_string(i);
+				templateParams.push_back("class " + tName);
+				params.push_back(tName + "&& " + name);
+				forwards.push_back("rpc::forward<" + tName + ">(" + name + ")");
+				conds.push_back(compatibility(tName, cppType));
+			}
+		}
+	}
+
+	/// Comma separated list.
+	static inline std::string list(const std::vector<std::string>& strs)
+	{
+		std::string ret;
+
+		for(const auto& s: strs)
+		{
+			ret += (ret.empty() ? "" : ", ") + s;
+		}
+
+		return ret;
+	}
+
+	/// Comma separated list continuing a preceding one.
+	static inline std::string tail(const std::vector<std::string>& strs)
+	{
+		std::string ret;
+
+		for(const auto& s: strs)
+		{
+			ret += ", " + s;
+		}
+
+		return ret;
+	}
+};
+
+/// Contract syntax of the call, for diagnostics.
+static inline std::string refSignature(const Contract::Action& a, const std::optional<Contract::TypeRef>& returnType = {})
+{
+	std::string ret = a.name + "(";
+
+	for(auto i = 0u; i < a.args.size(); i++)
+	{
+		ret += (i ? ", " : "") + a.args[i].name + ": " + std::visit([](const auto& t){ return refTypeRef(t); }, a.args[i].type);
+	}
+
+	ret += ")";
+
+	if(returnType)
+	{
+		ret += ": " + std::visit([](const auto& t){ return refTypeRef(t); }, *returnType);
+	}
+
+	return ret;
+}
+
 #endif /* RPC_TOOL_GEN_CPP_CPPPROXYCOMMON_H_ */
@@ -2,9 +2,25 @@
 
 #include "CppCommon.h"
 #include "CppProxyCommon.h"
+#include "CppMethodIds.h"
+
+#include <algorithm>
+#include <iomanip>
 
 namespace ServiceBuilderGenerator
 {
+	/// What to generate for each method.
+	struct Mode
+	{
+		const bool lean;
+
+		/// Method identifiers for the static dispatch table, per-instance registration if null.
+		const MethodIds* const ids;
+
+		/// Whether to generate the case of the dispatch table (instead of the checks).
+		const bool dispatch;
+	};
+
 	static inline void writeArgsCheckList(std::stringstream& ss, const Contract::Action& a, const std::string& cName, const int n)
 	{
 		const auto count = a.args.size();
@@ -22,16 +38,31 @@ namespace ServiceBuilderGenerator
 		}
 	}
 
+	static inline std::vector<std::string> argsConds(const Contract::Action& a, const std::string& cName)
+	{
+		const auto defName = definitionMemberFunctionName(a.name);
+		std::vector<std::string> ret = {"rpc::nArgs<&Child::" + defName + "> == " + std::to_string(a.args.size())};
+
+		for(auto i = 0u; i < a.args.size(); i++)
+		{
+			const auto cppType = std::visit([&cName](const auto& i) { return cppTypeRef(i, cName); }, a.args[i].type);
+			ret.push_back(compatibility("rpc::Arg<" + std::to_string(i) + ", &Child::" + defName + ">", cppType));
+		}
+
+		return ret;
+	}
+
 	static inline std::string provideLine(
 			const std::string &kind,
 			const std::string &symName,
 			const std::string &defName,
 			const std::vector<Contract::Var>& args,
-			std::vector<std::string> extra = {})
+			std::vector<std::string> extra = {},
+			const std::string &prefix = "this->template provide")
 	{
 		std::stringstream ss;
 
-		ss << "this->template provide" << kind << "<" << symName << ", Child, &Child::" << defName;
+		ss << prefix << kind << "<" << symName << ", Child, &Child::" << defName;
 
 		for(const auto& s: extra)
 		{
@@ -47,103 +78,206 @@ namespace ServiceBuilderGenerator
 		return ss.str();
 	}
 
-	static inline void handleItem(std::vector<std::string> &ret, const Contract::Function &f, const std::string& cName, const int n)
+	/// Line of the switch over the method identifiers that selects the handler of the method.
+	static inline std::string dispatchLine(
+			const uint32_t id,
+			const std::string &kind,
+			const std::string &symName,
+			const std::string &defName,
+			const std::vector<Contract::Var>& args,
+			std::vector<std::string> extra = {})
 	{
 		std::stringstream ss;
+		ss << "case 0x" << std::hex << std::setw(8) << std::setfill('0') << id << ": return ";
+		return ss.str() + provideLine(kind, symName, defName, args, extra, "v.template serve");
+	}
 
-		ss << indent(n) << "{" << std::endl;
-		writeArgsCheckList(ss, f, cName, n + 1);
-
+	static inline void handleItem(std::vector<std::string> &ret, const Contract::Function &f, const std::string& cName, const Mode& mode, const int n)
+	{
 		const auto defName = definitionMemberFunctionName(f.name);
 		const auto symName = contractSymbolsBlockNameRef(cName) + "::" + symbolName(f.name);
+		const auto kind = f.returnType.has_value() ? "Function" : "Action";
+
+		std::vector<std::string> extra;
+
+		if(f.returnType.has_value())
+		{
+			extra.push_back(std::visit([&cName](const auto& i) { return cppTypeRef(i, cName); }, f.returnType.value()));
+		}
+
+		if(mode.dispatch)
+		{
+			ret.push_back(dispatchLine(mode.ids->id(f), kind, symName, defName, f.args, extra));
+			return;
+		}
+
+		std::stringstream ss;
+
+		ss << indent(n) << "{" << std::endl;
 
-		if(!f.returnType.has_value())
+		if(mode.lean)
 		{
-			ss << indent(n + 1) << provideLine("Action", symName, defName, f.args);
+			auto conds = argsConds(f, cName);
+
+			if(f.returnType.has_value())
+			{
+				conds.push_back(compatibility("rpc::Ret<&Child::" + defName + ">", extra.front()));
+			}
+
+			ss << aggregateCheck(conds, "Public method " + defName + " must match '" + refSignature(f, f.returnType) + "'", n + 1);
 		}
 		else
 		{
-			const auto cppRetType = std::visit([&cName](const auto& i) { return cppTypeRef(i, cName); }, f.returnType.value());
-			const auto refRetType = std::visit([&cName](const auto& i) { return refTypeRef(i); }, f.returnType.value());
-			ss << argCheck("rpc::Ret<&Child::" + defName + ">", cppRetType, "Return type of " + f.name + " must be compatible with '" + refRetType + "'", n + 1);
-			ss << indent(n + 1) << provideLine("Function", symName, defName, f.args, {cppRetType});
+			writeArgsCheckList(ss, f, cName, n + 1);
+
+			if(f.returnType.has_value())
+			{
+				const auto refRetType = std::visit([&cName](const auto& i) { return refTypeRef(i); }, f.returnType.value());
+				ss << argCheck("rpc::Ret<&Child::" + defName + ">", extra.front(), "Return type of " + f.name + " must be compatible with '" + refRetType + "'", n + 1);
+			}
 		}
 
-		ss << std::endl << indent(n) << "}";
+		if(!mode.ids)
+		{
+			ss << indent(n + 1) << provideLine(kind, symName, defName, f.args, extra) << std::endl;
+		}
+
+		ss << indent(n) << "}";
 
 		ret.push_back(ss.str());
 	}
 
-	static inline void handleItem(std::vector<std::string> &ret, const Contract::Session &s, const std::string& cName, const int n)
+	static inline void handleItem(std::vector<std::string> &ret, const Contract::Session &s, const std::string& cName, const Mode& mode, const int n)
 	{
 		for(const auto& i: s.items)
 		{
-			if(const Contract::Function* f = std::get_if<Contract::Session::Ctor>(&i.second))
+			if(const Contract::Session::Ctor* f = std::get_if<Contract::Session::Ctor>(&i.second))
 			{
 				std::stringstream ss;
 
 				const auto defName = definitionMemberFunctionName(f->name);
 				const auto sObj = serverSessionName(cName, s.name);
 				const auto symName = contractSymbolsBlockNameRef(cName) + "::" + sessionNamespaceName(s.name) + "::" + symbolName(f->name);
-
-				ss << indent(n) << "{" << std::endl;
-
-				writeArgsCheckList(ss, *f, cName, n + 1);
+				const auto kind = f->returnType.has_value() ? "CtorWithRetval" : "Ctor";
 
 				const auto exportsExtra = contractTypeBlockNameRef(cName) + "::" + sessionNamespaceName(s.name) + "::" + sessionCallbackExportTypeName(s.name);
 				const auto acceptExtra = contractTypeBlockNameRef(cName) + "::" + sessionNamespaceName(s.name) + "::" + sessionAcceptSignatureTypeName(f->name);
 
-				if(!f->returnType.has_value())
+				if(mode.dispatch)
 				{
-					ss << indent(n + 1) << "static_assert(rpc::hasCrtpBase<" << sObj << ", decltype(*rpc::declval<rpc::Ret<&Child::"
-						<< defName << ">>())>, \"Session constructor " << f->name << " for " << s.name
-						<< " session must return a pointer-like object to a CRTP subclass of " << sObj << "\");" << std::endl;
+					ret.push_back(dispatchLine(mode.ids->id(s, *f), kind, symName, defName, f->args, {exportsExtra, acceptExtra}));
+					continue;
+				}
 
-					ss << indent(n + 1) << provideLine("Ctor", symName, defName, f->args, {exportsExtra, acceptExtra});
+				ss << indent(n) << "{" << std::endl;
+
+				if(mode.lean)
+				{
+					auto conds = argsConds(*f, cName);
+
+					if(!f->returnType.has_value())
+					{
+						conds.push_back("rpc::hasCrtpBase<" + sObj + ", decltype(*rpc::declval<rpc::Ret<&Child::" + defName + ">>())>");
+					}
+					else
+					{
+						const auto retType = "typename rpc::Ret<&Child::" + f->name + ">";
+						const auto cppTypeName = std::visit([&cName](const auto &i){return cppTypeRef(i, cName);}, f->returnType.value());
+						conds.push_back(compatibility("decltype(rpc::declval<" + retType + ">().first)", cppTypeName));
+						conds.push_back("rpc::hasCrtpBase<" + sObj + ", decltype(*rpc::declval<" + retType + ">().second)>");
+					}
+
+					const auto result = f->returnType.has_value() ? "a pair of the return value and a" : "a";
+
+					ss << aggregateCheck(conds, "Session constructor " + f->name + " for " + s.name + " session must match '" + refSignature(*f, f->returnType)
+							+ "' and return " + result + " pointer-like object to a CRTP subclass of " + sObj, n + 1);
 				}
 				else
 				{
-					const auto cppTypeName = std::visit([&cName](const auto &i){return cppTypeRef(i, cName);}, f->returnType.value());
-					const auto refTypeName = std::visit([](const auto &i){return refTypeRef(i);}, f->returnType.value());
-
-					const auto retType = "typename rpc::Ret<&Child::" + f->name + ">";
-					const auto retValCond = "rpc::isCompatible<decltype(rpc::declval<" + retType + ">().first), " + cppTypeName + ">()";
-					const auto objectCond = "rpc::hasCrtpBase<" + sObj + ", decltype(*rpc::declval<" + retType + ">().second)>";
-
-					ss << indent(n + 1) << "static_assert(" << retValCond << ", \"Session constructor " << f->name << " for " << s.name
-						<< " session must return a pair whose first member is a value compatible with " << refTypeName << "\");" << std::endl;
-
-					ss << indent(n + 1) << "static_assert(" << objectCond << ", \"Session constructor " << f->name << " for " << s.name
-						<< " session must return a pair whose second member is a pointer-like object to a CRTP subclass of "  << sObj << "\");" << std::endl;
+					writeArgsCheckList(ss, *f, cName, n + 1);
+
+					if(!f->returnType.has_value())
+					{
+						ss << indent(n + 1) << "static_assert(rpc::hasCrtpBase<" << sObj << ", decltype(*rpc::declval<rpc::Ret<&Child::"
+							<< defName << ">>())>, \"Session constructor " << f->name << " for " << s.name
+							<< " session must return a pointer-like object to a CRTP subclass of " << sObj << "\");" << std::endl;
+					}
+					else
+					{
+						const auto cppTypeName = std::visit([&cName](const auto &i){return cppTypeRef(i, cName);}, f->returnType.value());
+						const auto refTypeName = std::visit([](const auto &i){return refTypeRef(i);}, f->returnType.value());
+
+						const auto retType = "typename rpc::Ret<&Child::" + f->name + ">";
+						const auto retValCond = "rpc::isCompatible<decltype(rpc::declval<" + retType + ">().first), " + cppTypeName + ">()";
+						const auto objectCond = "rpc::hasCrtpBase<" + sObj + ", decltype(*rpc::declval<" + retType + ">().second)>";
+
+						ss << indent(n + 1) << "static_assert(" << retValCond << ", \"Session constructor " << f->name << " for " << s.name
+							<< " session must return a pair whose first member is a value compatible with " << refTypeName << "\");" << std::endl;
+
+						ss << indent(n + 1) << "static_assert(" << objectCond << ", \"Session constructor " << f->name << " for " << s.name
+							<< " session must return a pair whose second member is a pointer-like object to a CRTP subclass of "  << sObj << "\");" << std::endl;
+					}
+				}
 
-					ss << indent(n + 1) << provideLine("CtorWithRetval", symName, defName, f->args, {exportsExtra, acceptExtra});
+				if(!mode.ids)
+				{
+					ss << indent(n + 1) << provideLine(kind, symName, defName, f->args, {exportsExtra, acceptExtra}) << std::endl;
 				}
 
-				ss << std::endl << indent(n) << "}";
+				ss << indent(n) << "}";
 
 				ret.push_back(ss.str());
 			}
 		}
 	}
 
-	template<class C> static inline void handleItem(std::vector<std::string> &, const C&, const std::string&, const int n) {}
+	template<class C> static inline void handleItem(std::vector<std::string> &, const C&, const std::string&, const Mode&, const int n) {}
 
-	static inline std::string generateCtor(const Contract& c, const std::string& name)
+	static inline std::string generateCtor(const Contract& c, const std::string& name, const std::string& base, const MethodIds* ids, const GenContext& ctx)
 	{
-		std::vector<std::string> blocks;
-
 		const auto header = "template<class... Args>\n" +
 				indent(1) + name + "(Args&&... args):\n" +
-				indent(2) + name + "::ServiceBase(rpc::forward<Args>(args)...)";
+				indent(2) + name + "::" + base + "(rpc::forward<Args>(args)...)";
 
-		for(const auto& i: c.items) {
-			std::visit([&blocks, &c](const auto i){handleItem(blocks, i, c.name, 2);}, i.second);
-		}
+		const auto blocks = renderItems(ctx, c, "serviceCtor", [&c, mode{Mode{ctx.opts.lean, ids, false}}](auto& r, const auto& i) {
+			std::visit([&r, &c, &mode](const auto i){handleItem(r, i, c.name, mode, 2);}, i.second);
+		});
 
 		std::stringstream ss;
 		writeBlock(ss, header, blocks, 1);
 		return ss.str();
 	}
+
+	/*
+	 * The static dispatch table is a switch over the method identifiers, that is shared by all
+	 * instances, so that there is nothing to register when a service is created or destroyed.
+	 */
+	static inline std::string generateDispatch(const Contract& c, const MethodIds& ids, const GenContext& ctx)
+	{
+		auto cases = renderItems(ctx, c, "serviceDispatch", [&c, mode{Mode{ctx.opts.lean, &ids, true}}](auto& r, const auto& i) {
+			std::visit([&r, &c, &mode](const auto i){handleItem(r, i, c.name, mode, 3);}, i.second);
+		});
+
+		// The labels are of fixed width, so this orders them by identifier.
+		std::sort(cases.begin(), cases.end());
+
+		std::stringstream ss;
+		ss << indent(1) << "template<class Visitor>" << std::endl;
+		ss << indent(1) << "static inline auto dispatch(uint32_t id, Visitor&& v)" << std::endl;
+		ss << indent(1) << "{" << std::endl;
+		ss << indent(2) << "switch(id)" << std::endl;
+		ss << indent(2) << "{" << std::endl;
+
+		for(const auto& l: cases)
+		{
+			ss << indent(3) << l << std::endl;
+		}
+
+		ss << indent(3) << "default: return v.unknown();" << std::endl;
+		ss << indent(2) << "}" << std::endl;
+		ss << indent(1) << "}";
+		return ss.str();
+	}
 }
 
 namespace ServiceDemolisherGenerator
@@ -172,13 +306,11 @@ namespace ServiceDemolisherGenerator
 
 	template<class C> static inline void handleItem(std::vector<std::string> &, const C&, const std::string&, const int n) {}
 
-	static inline std::string generateDtor(const Contract& c, const std::string& name)
+	static inline std::string generateDtor(const Contract& c, const std::string& name, const GenContext& ctx)
 	{
-		std::vector<std::string> blocks;
-
-		for(const auto& i: c.items) {
-			std::visit([&blocks, &c](const auto i){handleItem(blocks, i, c.name, 2);}, i.second);
-		}
+		const auto blocks = renderItems(ctx, c, "serviceDtor", [&c](auto& r, const auto& i) {
+			std::visit([&r, &c](const auto i){handleItem(r, i, c.name, 2);}, i.second);
+		});
 
 		std::stringstream ss;
 		writeBlock(ss, "~" + name + "()", blocks, 1);
@@ -187,21 +319,39 @@ namespace ServiceDemolisherGenerator
 }
 
 
-void writeServerProxy(std::stringstream& ss, const Contract& c)
+void writeServerProxy(std::stringstream& ss, const Contract& c, const GenContext& ctx)
 {
 	const auto n = contractServerProxyNameDef(c.name);
 
-	auto ctor = ServiceBuilderGenerator::generateCtor(c, n);
+	std::optional<MethodIds> ids;
+
+	if(ctx.opts.staticDispatch)
+	{
+		ids.emplace(c);
+	}
+
+	const auto base = ids ? "StaticServiceBase" : "ServiceBase";
+	auto ctor = ServiceBuilderGenerator::generateCtor(c, n, base, ids ? &*ids : nullptr, ctx);
 
 	if(ctor.length())
 	{
 		ss << printDocs(c.docs, 0);
 
-		const auto header = "template<class Child, class Endpoint>\nstruct " + contractServerProxyNameRef(c.name) + ": rpc::ServiceBase<Endpoint>";
+		const auto header = "template<class Child, class Endpoint>\nstruct " + contractServerProxyNameRef(c.name) + ": rpc::" + base + "<Endpoint"
+				+ (ids ? ", " + contractServerProxyNameRef(c.name) + "<Child, Endpoint>" : "") + ">";
 
 		std::vector<std::string> result;
 		result.push_back(ctor);
-		result.push_back(ServiceDemolisherGenerator::generateDtor(c, n));
+
+		if(ids)
+		{
+			result.push_back(ServiceBuilderGenerator::generateDispatch(c, *ids, ctx));
+		}
+		else
+		{
+			result.push_back(ServiceDemolisherGenerator::generateDtor(c, n, ctx));
+		}
+
 		writeTopLevelBlock(ss, header, result);
 	}
 }
@@ -5,6 +5,8 @@
 
 #include <sstream>
 
-void writeServerProxy(std::stringstream&, const Contract&);
+struct GenContext;
+
+void writeServerProxy(std::stringstream&, const Contract&, const GenContext&);
 
 #endif /* RPC_TOOL_GEN_CPP_CPPSERVERPROXY_H_ */
@@ -13,6 +13,7 @@ struct SessionProxyFilter
 	virtual const Contract::Action* asImport(const Contract::Session::Item&) const = 0;
 	virtual const Contract::Action* asExport(const Contract::Session::Item&) const = 0;
 	virtual std::string friendName() const = 0;
+	virtual std::string friendParams() const = 0;
 	virtual std::string typeName() const = 0;
 	virtual std::string importedName() const = 0;
 	virtual std::string exportedName() const = 0;
@@ -23,8 +24,12 @@ std::unique_ptr<SessionProxyFilter> ClientSessionProxyFilterFactory::make(const
 {
 	struct Ret: SessionProxyFilter
 	{
-		using SessionProxyFilter::SessionProxyFilter;
-		virtual std::string friendName() const override { return "rpc::ClientBase"; };
+		const bool sharedLinks;
+		Ret(const std::string& cName, const std::string& sName, bool sharedLinks): SessionProxyFilter(cName, sName), sharedLinks(sharedLinks) {}
+
+		// The base the client proxy derives from, which also takes the link table when sharing the links.
+		virtual std::string friendName() const override { return sharedLinks ? "rpc::SharedLinkClientBase" : "rpc::ClientBase"; };
+		virtual std::string friendParams() const override { return sharedLinks ? "class, class" : "class"; };
 		virtual std::string typeName() const override { return clientSessionName(cName, sName); }
 		virtual std::string importedName() const override { return contractTypeBlockNameRef(cName) + "::" + sessionNamespaceName(sName) + "::" + sessionCallExportTypeName(sName); }
 		virtual std::string exportedName() const override { return contractTypeBlockNameRef(cName) + "::" + sessionNamespaceName(sName) + "::" + sessionCallbackExportTypeName(sName); }
@@ -32,15 +37,23 @@ std::unique_ptr<SessionProxyFilter> ClientSessionProxyFilterFactory::make(const
 		virtual const Contract::Action* asExport(const Contract::Session::Item& item) const override { return std::get_if<Contract::Session::CallBack>(&item.second);}
 	};
 
-	return std::make_unique<Ret>(cName, sName);
+	return std::make_unique<Ret>(cName, sName, sharedLinks);
+}
+
+std::string ClientSessionProxyFilterFactory::section() const {
+	return "clientSessions";
 }
 
 std::unique_ptr<SessionProxyFilter> ServerSessionProxyFilterFactory::make(const std::string& cName, const std::string& sName) const
 {
 	struct Ret: SessionProxyFilter
 	{
-		using SessionProxyFilter::SessionProxyFilter;
-		virtual std::string friendName() const override { return "rpc::ServiceBase"; };
+		const bool staticDispatch;
+		Ret(const std::string& cName, const std::string& sName, bool staticDispatch): SessionProxyFilter(cName, sName), staticDispatch(staticDispatch) {}
+
+		// The base the server proxy derives from, which also takes the proxy itself when dispatching statically.
+		virtual std::string friendName() const override { return staticDispatch ? "rpc::StaticServiceBase" : "rpc::ServiceBase"; };
+		virtual std::string friendParams() const override { return staticDispatch ? "class, class" : "class"; };
 		virtual std::string typeName() const override { return serverSessionName(cName, sName); }
 		virtual std::string importedName() const override { return contractTypeBlockNameRef(cName) + "::" + sessionNamespaceName(sName) + "::" + sessionCallbackExportTypeName(sName); }
 		virtual std::string exportedName() const override { return contractTypeBlockNameRef(cName) + "::" + sessionNamespaceName(sName) + "::" + sessionCallExportTypeName(sName); }
@@ -48,12 +61,17 @@ std::unique_ptr<SessionProxyFilter> ServerSessionProxyFilterFactory::make(const
 		virtual const Contract::Action* asExport(const Contract::Session::Item& item) const override { return std::get_if<Contract::Session::ForwardCall>(&item.second);}
 	};
 
-	return std::make_unique<Ret>(cName, sName);
+	return std::make_unique<Ret>(cName, sName, staticDispatch);
+}
+
+std::string ServerSessionProxyFilterFactory::section() const {
+	return "serverSessions";
 }
 
-std::string generateExportLocalMethod(const SessionProxyFilter& nGen, const Contract::Session& s, const int n)
+std::string generateExportLocalMethod(const SessionProxyFilter& nGen, const Contract::Session& s, const bool lean, const bool table, const int n)
 {
 	std::stringstream ss;
+	std::vector<std::string> entries;
 
 	ss << indent(n) << "template<class Ep, class Self>" << std::endl;
 	ss << indent(n) << "inline auto exportLocal(Ep& ep, Self self)" << std::endl;
@@ -67,36 +85,77 @@ std::string generateExportLocalMethod(const SessionProxyFilter& nGen, const Cont
 			const auto defName = definitionMemberFunctionName(a->name);
 			const auto count = a->args.size();
 
-			ss << indent(n + 1) << "static_assert(rpc::nArgs<&Child::" << defName << "> == " << count << ", "
-				<< "\"Public method " << a->name << " must take " << count << " argument"
-				<< ((count > 1) ? "s" : "") << "\");" << std::endl;
+			if(lean)
+			{
+				std::vector<std::string> conds = {"rpc::nArgs<&Child::" + defName + "> == " + std::to_string(count)};
 
-			for(auto i = 0u; i < a->args.size(); i++)
+				for(auto i = 0u; i < a->args.size(); i++)
+				{
+					const auto cppTypeName = std::visit([&nGen](const auto &i){return cppTypeRef(i, nGen.cName);}, a->args[i].type);
+					conds.push_back(compatibility("rpc::Arg<" + std::to_string(i) + ", &Child::" + defName + ">", cppTypeName));
+				}
+
+				ss << aggregateCheck(conds, "Public method " + defName + " must match '" + refSignature(*a) + "'", n + 1);
+			}
+			else
 			{
-				const auto cppTypeName = std::visit([&nGen](const auto &i){return cppTypeRef(i, nGen.cName);}, a->args[i].type);
-				const auto refTypeName = std::visit([](const auto &i){return refTypeRef(i);}, a->args[i].type);
+				ss << indent(n + 1) << "static_assert(rpc::nArgs<&Child::" << defName << "> == " << count << ", "
+					<< "\"Public method " << a->name << " must take " << count << " argument"
+					<< ((count > 1) ? "s" : "") << "\");" << std::endl;
+
+				for(auto i = 0u; i < a->args.size(); i++)
+				{
+					const auto cppTypeName = std::visit([&nGen](const auto &i){return cppTypeRef(i, nGen.cName);}, a->args[i].type);
+					const auto refTypeName = std::visit([](const auto &i){return refTypeRef(i);}, a->args[i].type);
 
-				const auto msg = "Argument #" + std::to_string(i + 1) + " of " + defName
-						+ " must have type compatible with '" + refTypeName + "'";
+					const auto msg = "Argument #" + std::to_string(i + 1) + " of " + defName
+							+ " must have type compatible with '" + refTypeName + "'";
 
-				ss << argCheck("rpc::Arg<" + std::to_string(i) + ", &Child::" + defName + ">", cppTypeName, msg , n + 1);
+					ss << argCheck("rpc::Arg<" + std::to_string(i) + ", &Child::" + defName + ">", cppTypeName, msg , n + 1);
+				}
 			}
 
-			ss << indent(n + 1) << "exportCall<&" << nGen.exportedName() << "::" << defName << ", &Child::" << defName << ", Ep, Self";
+			std::stringstream args;
 
 			for(auto i = 0u; i < a->args.size(); i++)
 			{
-				ss << ", rpc::Arg<" + std::to_string(i) + ", &Child::" + defName + ">";
+				args << ", rpc::Arg<" + std::to_string(i) + ", &Child::" + defName + ">";
+			}
+
+			if(table)
+			{
+				entries.push_back("rpc::ExportEntry<&" + nGen.exportedName() + "::" + defName + ", &Child::" + defName + args.str() + ">");
+				continue;
 			}
 
-			ss << ">(ep, self);" << std::endl;
+			ss << indent(n + 1) << "exportCall<&" << nGen.exportedName() << "::" << defName << ", &Child::" << defName << ", Ep, Self" << args.str() << ">(ep, self);" << std::endl;
 
 			ss << sep;
 			sep = "\n";
 		}
 	}
 
-	ss << indent(n + 1) << "return finalizeExports<&Child::onClosed>(ep, self);" << std::endl;
+	if(table)
+	{
+		// A single table per session type, instead of registering the calls one by one.
+		if(entries.size())
+		{
+			ss << std::endl;
+		}
+
+		ss << indent(n + 1) << "return exportTable<&Child::onClosed, Ep, Self";
+
+		for(const auto& e: entries)
+		{
+			ss << "," << std::endl << indent(n + 2) << e;
+		}
+
+		ss << (entries.size() ? "\n" + indent(n + 1) : "") << ">(ep, self);" << std::endl;
+	}
+	else
+	{
+		ss << indent(n + 1) << "return finalizeExports<&Child::onClosed>(ep, self);" << std::endl;
+	}
 
 	ss << indent(n) << "}";
 	return ss.str();
@@ -158,17 +217,34 @@ std::string generateImportProxyMethod(const SessionProxyFilter& nGen, const Cont
 	return ss.str();
 }
 
-void writeSessionProxies(std::stringstream& ss, const Contract& c, const SessionProxyFilterFactory& f)
+std::string generateLeanImportProxyMethod(const SessionProxyFilter& nGen, const Contract::Action& a, const int n)
+{
+	std::stringstream ss;
+
+	const LeanArgs args(a.args, nGen.cName);
+	const auto defName = definitionMemberFunctionName(a.name);
+
+	ss << indent(n) << "template<class Ep" << LeanArgs::tail(args.templateParams) << ">" << std::endl;
+	ss << indent(n) << "inline auto " << defName << "(Ep& ep" << LeanArgs::tail(args.params) << ")" << std::endl;
+	ss << indent(n) << "{" << std::endl;
+	ss << aggregateCheck(args.conds, "Call to " + defName + " must match '" + refSignature(a) + "'", n + 1);
+	ss << indent(n + 1) << "return this->callImported<&" << nGen.importedName() << "::" << defName << ">(ep" << LeanArgs::tail(args.forwards) << ");" << std::endl;
+	ss << indent(n) << "}";
+	return ss.str();
+}
+
+void writeSessionProxies(std::stringstream& ss, const Contract& c, const SessionProxyFilterFactory& f, const GenContext& ctx)
 {
-	for(const auto& i: c.items)
+	const auto blocks = renderItems(ctx, c, f.section(), [&c, &f, &ctx](auto& r, const auto& i)
 	{
 		if(const Contract::Session* s = std::get_if<Contract::Session>(&i.second))
 		{
+			std::stringstream ss;
 			auto nGen = f.make(c.name, s->name);
 			std::vector<std::string> result;
 
-			result.push_back(indent(1) + "template<class> friend class " + nGen->friendName() + ";");
-			result.push_back(generateExportLocalMethod(*nGen, *s, 1));
+			result.push_back(indent(1) + "template<" + nGen->friendParams() + "> friend class " + nGen->friendName() + ";");
+			result.push_back(generateExportLocalMethod(*nGen, *s, ctx.opts.lean, ctx.opts.staticExports, 1));
 			result.push_back(generateImportRemoteMethod(*nGen, nGen->importedName(), 1));
 			result.push_back("public:");
 
@@ -176,19 +252,25 @@ void writeSessionProxies(std::stringstream& ss, const Contract& c, const Session
 			{
 				if(const Contract::Action* a = nGen->asImport(item))
 				{
-					result.push_back(generateImportProxyMethod(*nGen, *a, 1));
+					result.push_back(ctx.opts.lean ? generateLeanImportProxyMethod(*nGen, *a, 1) : generateImportProxyMethod(*nGen, *a, 1));
 				}
 			}
 
 			ss << printDocs(i.first, 0);
 
 			std::stringstream hs;
-			hs << "template<class Child>" << std::endl;
+			hs << exportKeyword(ctx) << "template<class Child>" << std::endl;
 
 			const auto exportCount = std::count_if(s->items.begin(), s->items.end(), [&nGen](const auto& i) {return nGen->asExport(i) != nullptr; });
 
 			hs << "class " << nGen->typeName() << ": public rpc::SessionBase<" << nGen->importedName() << ", " << nGen->exportedName() << ", " << exportCount << ">";
 			writeTopLevelBlock(ss, hs.str(), result, true);
+			r.push_back(ss.str());
 		}
+	});
+
+	for(const auto& b: blocks)
+	{
+		ss << b;
 	}
 }
@@ -5,28 +5,39 @@
 
 #include <sstream>
 
+struct GenContext;
+
 struct SessionProxyFilter;
 
 struct SessionProxyFilterFactory
 {
 	virtual std::unique_ptr<SessionProxyFilter> make(const std::string& cName, const std::string& sName) const = 0;
+	virtual std::string section() const = 0;
 	virtual ~SessionProxyFilterFactory() = default;
 };
 
 class ClientSessionProxyFilterFactory: public SessionProxyFilterFactory
 {
+	const bool sharedLinks;
+
 	virtual std::unique_ptr<SessionProxyFilter> make(const std::string& cName, const std::string& sName) const override;
+	virtual std::string section() const override;
 public:
+	inline ClientSessionProxyFilterFactory(bool sharedLinks): sharedLinks(sharedLinks) {}
 	inline virtual ~ClientSessionProxyFilterFactory() = default;
 };
 
 class ServerSessionProxyFilterFactory: public SessionProxyFilterFactory
 {
+	const bool staticDispatch;
+
 	virtual std::unique_ptr<SessionProxyFilter> make(const std::string& cName, const std::string& sName) const override;
+	virtual std::string section() const override;
 public:
+	inline ServerSessionProxyFilterFactory(bool staticDispatch): staticDispatch(staticDispatch) {}
 	inline virtual ~ServerSessionProxyFilterFactory() = default;
 };
 
-void writeSessionProxies(std::stringstream&, const Contract&, const SessionProxyFilterFactory&);
+void writeSessionProxies(std::stringstream&, const Contract&, const SessionProxyFilterFactory&, const GenContext&);
 
 #endif /* RPC_TOOL_GEN_CPP_CPPSESSIONPROXY_H_ */
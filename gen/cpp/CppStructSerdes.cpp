@@ -1,41 +1,207 @@
 #include "CppStructSerdes.h"
 
 #include "CppCommon.h"
+#include "CppWireLayout.h"
 
 #include <algorithm>
 
 struct StructTypeInfoGenerator
 {
-	static inline std::string serDesEntry(const std::string& name, const std::vector<std::string>& a, const int n)
+	struct Mode
+	{
+		bool packed, unrolled;
+	};
+
+	/// Members serialized together, a single one (possibly varint encoded) or a run of flags packed into bits.
+	struct Group
+	{
+		std::vector<std::string> members;
+		bool varint = false;
+	};
+
+	static inline std::vector<Group> ungrouped(const std::vector<std::string>& a)
+	{
+		std::vector<Group> ret;
+		std::transform(a.begin(), a.end(), std::back_inserter(ret), [](const auto &m){ return Group{{m}}; });
+		return ret;
+	}
+
+	static inline std::vector<Group> grouped(const Contract::Aggregate& a, const WireLayout& layout)
+	{
+		std::vector<Group> ret;
+
+		for(const auto& g: layout.groups(a))
+		{
+			Group r{{}, !g.flags && layout.isVarint(a.members[g.first].type)};
+			std::transform(a.members.begin() + g.first, a.members.begin() + g.first + g.count, std::back_inserter(r.members), [](const auto &i){ return i.name; });
+			ret.push_back(std::move(r));
+		}
+
+		return ret;
+	}
+
+	static inline std::string serDesEntry(const std::string& name, const std::vector<Group>& a, const int n, const std::string& base = "StructTypeInfo", const std::string& body = "{}")
 	{
 
 		std::stringstream ss;
-		ss << indent(n) << "template<template<class> class Collection> struct TypeInfo<" << name << "<Collection>>: StructTypeInfo<" << std::endl;
+		ss << indent(n) << "template<template<class> class Collection> struct TypeInfo<" << name << "<Collection>>: " << base << "<" << std::endl;
 		ss << indent(n + 1) << name << "<Collection>";
 
-		for(const auto& m: a)
+		for(const auto& g: a)
+		{
+			ss << "," << std::endl << indent(n + 1) << ((g.members.size() > 1) ? "StructFlags<" : g.varint ? "StructVarint<" : "StructMember<");
+
+			for(auto i = 0u; i < g.members.size(); i++)
+			{
+				ss << (i ? ", " : "") << "&" << name << "<Collection>::" << g.members[i];
+			}
+
+			ss << ">";
+		}
+
+		ss << std::endl << indent(n) << "> " << body << ";";
+
+
+		return ss.str();
+	}
+
+	/// The serializer of a group, flags are handled by the runtime together.
+	static inline std::string unrolledInfo(const std::string& type, const Group& g)
+	{
+		if(g.members.size() > 1)
+		{
+			return "FlagsInfo<" + std::to_string(g.members.size()) + ">";
+		}
+
+		const auto member = "decltype(" + type + "::" + g.members.front() + ")";
+		return "TypeInfo<" + (g.varint ? ("rpc::Varint<" + member + ">") : member) + ">";
+	}
+
+	/// Varint encoded members are passed through the adaptor of the runtime, as they are stored as plain integers.
+	static inline std::string unrolledArgs(const std::string& type, const Group& g)
+	{
+		if(g.varint)
+		{
+			return "rpc::Varint<decltype(" + type + "::" + g.members.front() + ")>::ref(v." + g.members.front() + ")";
+		}
+
+		std::string ret;
+
+		for(auto i = 0u; i < g.members.size(); i++)
+		{
+			ret += (i ? ", v." : "v.") + g.members[i];
+		}
+
+		return ret;
+	}
+
+	static inline std::string unrolledSum(const std::string& type, const std::vector<Group>& a, const std::string& op, const std::string& fallback, const std::function<std::string(const Group&)>& term, const int n)
+	{
+		if(a.empty())
+		{
+			return indent(n) + "return " + fallback + ";";
+		}
+
+		std::stringstream ss;
+		ss << indent(n) << "return ";
+
+		for(auto i = 0u; i < a.size(); i++)
+		{
+			ss << (i ? "\n" + indent(n + 1) + op + " " : "") << unrolledInfo(type, a[i]) << "::" << term(a[i]);
+		}
+
+		ss << ";";
+		return ss.str();
+	}
+
+	/*
+	 * The member sequence written out by the generator, instead of being walked by the variadic
+	 * templates of StructTypeInfo, so that the compiler only sees one flat function per operation.
+	 */
+	static inline std::string unrolledSerDesEntry(const std::string& name, const std::vector<Group>& a, const bool fixed, const int n)
+	{
+		const auto type = name + "<Collection>";
+
+		std::stringstream ss;
+		ss << indent(n) << "template<template<class> class Collection> struct TypeInfo<" << type << ">" << std::endl;
+		ss << indent(n) << "{" << std::endl;
+		ss << indent(n + 1) << "static constexpr auto sgn = structSignature(";
+
+		for(auto i = 0u; i < a.size(); i++)
 		{
-			ss << "," << std::endl << indent(n + 1) << "StructMember<&" << name << "<Collection>::" << m << ">";
+			ss << (i ? ", " : "") << unrolledInfo(type, a[i]) << "::sgn";
 		}
 
-		ss << std::endl << indent(n) << "> {};";
+		ss << ");" << std::endl;
+		ss << indent(n + 1) << "static constexpr bool isFixedSize = " << (fixed ? "true" : "false") << ";" << std::endl << std::endl;
+
+		ss << indent(n + 1) << "static constexpr inline size_t size(const " << type << "& v)" << std::endl;
+		ss << indent(n + 1) << "{" << std::endl;
+		ss << unrolledSum(type, a, "+", "0", [&type](const auto& g){ return "size(" + unrolledArgs(type, g) + ")"; }, n + 2) << std::endl;
+		ss << indent(n + 1) << "}" << std::endl << std::endl;
 
+		ss << indent(n + 1) << "template<class S>" << std::endl;
+		ss << indent(n + 1) << "static inline bool write(S& s, const " << type << "& v)" << std::endl;
+		ss << indent(n + 1) << "{" << std::endl;
+		ss << unrolledSum(type, a, "&&", "true", [&type](const auto& g){ return "write(s, " + unrolledArgs(type, g) + ")"; }, n + 2) << std::endl;
+		ss << indent(n + 1) << "}" << std::endl << std::endl;
 
+		ss << indent(n + 1) << "template<class S>" << std::endl;
+		ss << indent(n + 1) << "static inline bool read(S& s, " << type << "& v)" << std::endl;
+		ss << indent(n + 1) << "{" << std::endl;
+		ss << unrolledSum(type, a, "&&", "true", [&type](const auto& g){ return "read(s, " + unrolledArgs(type, g) + ")"; }, n + 2) << std::endl;
+		ss << indent(n + 1) << "}" << std::endl;
+
+		ss << indent(n) << "};";
 		return ss.str();
 	}
 
-	static inline std::string handleTypeDef(const std::string& name, const Contract::Aggregate& a, const int n)
+	/*
+	 * Aggregates of fixed size are generated packed, so they are serialized by copying the whole
+	 * object in one go (the members are still listed for byte swapping if the endianness differs).
+	 */
+	static inline std::string trivialSerDesEntry(const std::string& name, const Contract::Aggregate& a, const WireLayout& layout, const int n)
 	{
-		std::vector<std::string> contents;
-		std::transform(a.members.begin(), a.members.end(), std::back_inserter(contents), [](const auto &i){ return i.name; });
+		std::stringstream ss;
+		ss << "{" << std::endl;
+
+		const auto type = name + "<Collection>";
+		const auto size = *layout.fixedSize(a);
+		ss << indent(n + 1) << "static_assert(sizeof(" << type << ") == " << size << ", \"" << name << " must be " << size << " byte" << (size > 1 ? "s" : "") << " long like on the wire\");" << std::endl;
+
+		size_t offset = 0;
+		for(const auto& m: a.members)
+		{
+			ss << indent(n + 1) << "static_assert(offsetof(" << type << ", " << m.name << ") == " << offset << ", \"" << name << "::" << m.name << " must be at offset " << offset << " like on the wire\");" << std::endl;
+			offset += *std::visit([&layout](const auto& t){ return layout.fixedSize(t); }, m.type);
+		}
+
+		ss << indent(n) << "}";
+		return serDesEntry(name, grouped(a, layout), n, "TrivialStructTypeInfo", ss.str());
+	}
+
+	static inline std::string handleTypeDef(const std::string& name, const Contract::Aggregate& a, const WireLayout& layout, const Mode& mode, const int n)
+	{
+		if(mode.packed && layout.trivialSize(a))
+		{
+			return trivialSerDesEntry(name, a, layout, n);
+		}
+
+		const auto contents = grouped(a, layout);
+
+		if(mode.unrolled)
+		{
+			return unrolledSerDesEntry(name, contents, layout.fixedSize(a).has_value(), n);
+		}
+
 		return serDesEntry(name, contents, n);
 	}
 
 	template<class T>
-	static inline std::string handleTypeDef(const std::string& name, const T& t, const int n) { return {}; }
+	static inline std::string handleTypeDef(const std::string& name, const T& t, const WireLayout&, const Mode&, const int n) { return {}; }
 
-	static inline std::string handleItem(const std::string& contractName, const Contract::Alias &a, const int n) {
-		return std::visit([name{contractParametricBlockNameRef(contractName) + "::" + userTypeName(a.name)}, n](const auto &t){ return handleTypeDef(name, t, n); }, a.type);
+	static inline std::string handleItem(const std::string& contractName, const Contract::Alias &a, const WireLayout& layout, const Mode& mode, const int n) {
+		return std::visit([name{contractParametricBlockNameRef(contractName) + "::" + userTypeName(a.name)}, &layout, &mode, n](const auto &t){ return handleTypeDef(name, t, layout, mode, n); }, a.type);
 	}
 
 	template<class T> static inline void handleSessionItem(const T& t, std::vector<std::string> &fwd, std::vector<std::string> &bwd) {}
@@ -48,7 +214,7 @@ struct StructTypeInfoGenerator
 		bwd.push_back(t.name);
 	}
 
-	static inline std::string handleItem(const std::string& contractName, const Contract::Session &s, const int n)
+	static inline std::string handleItem(const std::string& contractName, const Contract::Session &s, const WireLayout&, const Mode& mode, const int n)
 	{
 		std::vector<std::string> fwd, bwd;
 
@@ -63,21 +229,31 @@ struct StructTypeInfoGenerator
 		const auto baseName = contractParametricBlockNameRef(contractName) + "::" + sessionNamespaceName(s.name);
 		std::stringstream ss;
 
-		ss << serDesEntry(baseName + "::" + sessionCallExportTypeName(s.name), fwd, n) << std::endl << std::endl;
-		ss << serDesEntry(baseName + "::" + sessionCallbackExportTypeName(s.name), bwd, n);
+		if(mode.unrolled)
+		{
+			// The exports are made up of call references only, so they are always of fixed size.
+			ss << unrolledSerDesEntry(baseName + "::" + sessionCallExportTypeName(s.name), ungrouped(fwd), true, n) << std::endl << std::endl;
+			ss << unrolledSerDesEntry(baseName + "::" + sessionCallbackExportTypeName(s.name), ungrouped(bwd), true, n);
+		}
+		else
+		{
+			ss << serDesEntry(baseName + "::" + sessionCallExportTypeName(s.name), ungrouped(fwd), n) << std::endl << std::endl;
+			ss << serDesEntry(baseName + "::" + sessionCallbackExportTypeName(s.name), ungrouped(bwd), n);
+		}
 
 		return ss.str();
 	}
 
-	template<class C> static inline std::string handleItem(const std::string&, const C&, const int n) { return {}; }
+	template<class C> static inline std::string handleItem(const std::string&, const C&, const WireLayout&, const Mode&, const int n) { return {}; }
 };
 
-void writeStructTypeInfo(std::stringstream &ss, const Contract& c)
+void writeStructTypeInfo(std::stringstream &ss, const Contract& c, const GenContext& ctx)
 {
-	std::vector<std::string> strs;
+	const WireLayout layout(c);
+	const StructTypeInfoGenerator::Mode mode{ctx.opts.packed, ctx.opts.unrolledSerdes};
 
-	std::transform(c.items.begin(), c.items.end(), std::back_inserter(strs), [&c](const auto &i){
-		return std::visit([&c](const auto& i){ return StructTypeInfoGenerator::handleItem(c.name, i, 1); }, i.second);
+	const auto strs = renderItems(ctx, c, "typeinfo", [&c, &layout, &mode](auto& r, const auto &i){
+		r.push_back(std::visit([&c, &layout, &mode](const auto& i){ return StructTypeInfoGenerator::handleItem(c.name, i, layout, mode, 1); }, i.second));
 	});
 
 	writeTopLevelBlock(ss, "namespace rpc", strs, false);
@@ -5,6 +5,8 @@
 
 #include <sstream>
 
-void writeStructTypeInfo(std::stringstream &ss, const Contract& c);
+struct GenContext;
+
+void writeStructTypeInfo(std::stringstream &ss, const Contract& c, const GenContext& ctx);
 
 #endif /* RPC_TOOL_GEN_CPP_CPPSTRUCTSERDES_H_ */
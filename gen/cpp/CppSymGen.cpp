@@ -1,40 +1,54 @@
 #include "CppSymGen.h"
 
 #include "CppCommon.h"
+#include "CppMethodIds.h"
 
 #include <algorithm>
+#include <iomanip>
 
 struct CommonSymbolGenerator
 {
 	template<class C>
-	static inline std::string handleItem(const std::string& cName, const C &f, const int n) { return {}; }
+	static inline std::string handleItem(const std::string& cName, const C &f, const MethodIds*, const int n) { return {}; }
 
-	static inline std::string symbol(const std::string& name, const std::string& type, const int n)
+	static inline std::string symbol(const std::string& name, const std::string& type, const std::optional<uint32_t>& id, const int n)
 	{
 		std::stringstream ss;
 		ss << indent(n) << "static constexpr inline auto " << symbolName(name);
-		ss << " = rpc::symbol(" << type << "(), \"" << name << "\"_ctstr);";
+
+		if(id)
+		{
+			ss << " = rpc::symbol(" << type << "(), rpc::NumericId<0x" << std::hex << std::setw(8) << std::setfill('0') << *id << ">());";
+		}
+		else
+		{
+			ss << " = rpc::symbol(" << type << "(), \"" << name << "\"_ctstr);";
+		}
+
 		return ss.str();
 	}
 
-	static inline std::string handleItem(const std::string& cName, const Contract::Function &f, const int n)
+	static inline std::string handleItem(const std::string& cName, const Contract::Function &f, const MethodIds* ids, const int n)
 	{
-		return symbol(f.name, cName + "::" + ((f.returnType) ? functionSignatureTypeName(f.name) : actionSignatureTypeName(f.name)), n);
+		const auto id = ids ? std::optional<uint32_t>(ids->id(f)) : std::nullopt;
+		return symbol(f.name, cName + "::" + ((f.returnType) ? functionSignatureTypeName(f.name) : actionSignatureTypeName(f.name)), id, n);
 	}
 
-	static inline std::string handleSessionItem(const std::string& typeName, const Contract::Session::Ctor & c, const int n) {
-		return symbol(c.name, typeName + "::" + sessionCreateSignatureTypeName(c.name) , n);
+	static inline std::string handleSessionItem(const std::string& typeName, const Contract::Session& s, const Contract::Session::Ctor & c, const MethodIds* ids, const int n)
+	{
+		const auto id = ids ? std::optional<uint32_t>(ids->id(s, c)) : std::nullopt;
+		return symbol(c.name, typeName + "::" + sessionCreateSignatureTypeName(c.name), id, n);
 	}
 
-	template<class C> static inline std::string handleSessionItem(const std::string&, const C&, const int n) { return {}; }
+	template<class C> static inline std::string handleSessionItem(const std::string&, const Contract::Session&, const C&, const MethodIds*, const int n) { return {}; }
 
-	static inline std::string handleItem(const std::string& cName, const Contract::Session &s, const int n)
+	static inline std::string handleItem(const std::string& cName, const Contract::Session &s, const MethodIds* ids, const int n)
 	{
 		std::stringstream ss;
 
 		std::vector<std::string> strs;
-		std::transform(s.items.begin(), s.items.end(), std::back_inserter(strs), [n, t{cName + "::" + sessionNamespaceName(s.name)}](const auto &it){
-			return std::visit([n, t](const auto& i){ return handleSessionItem(t, i, n + 1); }, it.second);
+		std::transform(s.items.begin(), s.items.end(), std::back_inserter(strs), [&s, ids, n, t{cName + "::" + sessionNamespaceName(s.name)}](const auto &it){
+			return std::visit([&s, ids, n, t](const auto& i){ return handleSessionItem(t, s, i, ids, n + 1); }, it.second);
 		});
 
 		writeBlock(ss, "struct " + sessionNamespaceName(s.name), strs, n);
@@ -43,12 +57,19 @@ struct CommonSymbolGenerator
 	}
 };
 
-void writeContractSymbols(std::stringstream &ss, const Contract& c)
+void writeContractSymbols(std::stringstream &ss, const Contract& c, const GenContext& ctx)
 {
-	std::vector<std::string> strs;
+	std::optional<MethodIds> gen;
+
+	if(ctx.opts.numericIds)
+	{
+		gen.emplace(c);
+	}
+
+	const auto ids = gen ? &*gen : nullptr;
 
-	std::transform(c.items.begin(), c.items.end(), std::back_inserter(strs), [&c, t{contractTypeBlockNameRef(c.name)}](const auto &i){
-		return std::visit([&c, t](const auto& i){ return CommonSymbolGenerator::handleItem(t, i, 1); }, i.second);
+	const auto strs = renderItems(ctx, c, "symbols", [ids, t{contractTypeBlockNameRef(c.name)}](auto& r, const auto &i){
+		r.push_back(std::visit([&t, ids](const auto& i){ return CommonSymbolGenerator::handleItem(t, i, ids, 1); }, i.second));
 	});
 
 	writeTopLevelBlock(ss, "struct " + contractSymbolsBlockNameRef(c.name), strs);
@@ -5,6 +5,8 @@
 
 #include <sstream>
 
-void writeContractSymbols(std::stringstream &ss, const Contract& c);
+struct GenContext;
+
+void writeContractSymbols(std::stringstream &ss, const Contract& c, const GenContext& ctx);
 
 #endif /* RPC_TOOL_GEN_CPP_CPPSYMGEN_H_ */
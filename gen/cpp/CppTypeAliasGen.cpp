@@ -7,27 +7,29 @@
 
 struct TypeAliasGenerator
 {
-	static inline std::string alias(const std::string& pName, const std::string &eName, const int n) {
-		return indent(n) + "using " + eName + " = " + pName + "::" + eName + "<rpc::Many>;";
+	const std::string collection;
+
+	inline std::string alias(const std::string& pName, const std::string &eName, const int n) const {
+		return indent(n) + "using " + eName + " = " + pName + "::" + eName + "<" + collection + ">;";
 	}
 
-	static inline void handleSessionItem(std::vector<std::string> &r, const std::string pName, const Contract::Session::ForwardCall &f, const int n)
+	inline void handleSessionItem(std::vector<std::string> &r, const std::string pName, const Contract::Session::ForwardCall &f, const int n) const
 	{
 		r.push_back(alias(pName, sessionForwardCallSignatureTypeName(f.name), n));
 	}
 
-	static inline void handleSessionItem(std::vector<std::string> &r, const std::string pName, const Contract::Session::CallBack & cb, const int n)
+	inline void handleSessionItem(std::vector<std::string> &r, const std::string pName, const Contract::Session::CallBack & cb, const int n) const
 	{
 		r.push_back(alias(pName, sessionCallbackSignatureTypeName(cb.name), n));
 	}
 
-	static inline void handleSessionItem(std::vector<std::string> &r, const std::string pName, const Contract::Session::Ctor & c, const int n)
+	inline void handleSessionItem(std::vector<std::string> &r, const std::string pName, const Contract::Session::Ctor & c, const int n) const
 	{
 		r.push_back(alias(pName, sessionAcceptSignatureTypeName(c.name), n));
 		r.push_back(alias(pName, sessionCreateSignatureTypeName(c.name), n));
 	}
 
-	static inline void handleItem(std::vector<std::string> &r, const std::string pName, const Contract::Session &s, const int n)
+	inline void handleItem(std::vector<std::string> &r, const std::string pName, const Contract::Session &s, const int n) const
 	{
 		std::vector<std::string> result;
 
@@ -37,7 +39,7 @@ struct TypeAliasGenerator
 		result.push_back(alias(sName, sessionCallbackExportTypeName(s.name), n + 1));
 
 		for(const auto& it: s.items) {
-			std::visit([n, &result, &sName](const auto& i){ return handleSessionItem(result, sName, i, n + 1); }, it.second);
+			std::visit([this, n, &result, &sName](const auto& i){ return handleSessionItem(result, sName, i, n + 1); }, it.second);
 		}
 
 		std::stringstream ss;
@@ -46,24 +48,43 @@ struct TypeAliasGenerator
 		r.push_back(ss.str());
 	}
 
-	static inline void handleItem(std::vector<std::string> &r, const std::string pName, const Contract::Alias &a, const int n) {
+	inline void handleItem(std::vector<std::string> &r, const std::string pName, const Contract::Alias &a, const int n) const {
 		r.push_back(alias(pName, userTypeName(a.name), n));
 	}
 
-	static inline void handleItem(std::vector<std::string> &r, const std::string pName, const Contract::Function &f, const int n) {
+	inline void handleItem(std::vector<std::string> &r, const std::string pName, const Contract::Function &f, const int n) const {
 		r.push_back(alias(pName, (f.returnType) ? functionSignatureTypeName(f.name) : actionSignatureTypeName(f.name), n));
 	}
 };
 
-void writeContractTypeAliases(std::stringstream &ss, const Contract& c)
+static inline void writeAliasBlock(std::stringstream &ss, const Contract& c, const GenContext& ctx, const std::string& section, const std::string& block, const std::string& collection)
 {
 	const std::string pName = contractParametricBlockNameRef(c.name);
+	const TypeAliasGenerator gen{collection};
 
-	std::vector<std::string> result;
-	for(const auto& i: c.items)
-	{
-		std::visit([&result, &pName](const auto& i){ TypeAliasGenerator::handleItem(result, pName, i, 1); }, i.second);
-	}
+	const auto result = renderItems(ctx, c, section, [&pName, &gen](auto& r, const auto& i){
+		std::visit([&r, &pName, &gen](const auto& i){ gen.handleItem(r, pName, i, 1); }, i.second);
+	});
+
+	writeTopLevelBlock(ss, "struct " + block, result);
+}
+
+void writeContractTypeAliases(std::stringstream &ss, const Contract& c, const GenContext& ctx) {
+	writeAliasBlock(ss, c, ctx, "types", contractTypeBlockNameRef(c.name), "rpc::Many");
+}
+
+/*
+ * Same shape as the Types block, but with rpc::View as the collection, which the runtime
+ * deserializes as a non-owning range over the receive buffer (a plain span for primitives).
+ */
+void writeContractViewAliases(std::stringstream &ss, const Contract& c, const GenContext& ctx) {
+	writeAliasBlock(ss, c, ctx, "views", contractViewBlockNameRef(c.name), "rpc::View");
+}
 
-	writeTopLevelBlock(ss, "struct " + contractTypeBlockNameRef(c.name), result);
+/*
+ * Collections allocated from the arena of the call being served, so that a deeply nested
+ * message is released at once when the handler returns instead of one collection at a time.
+ */
+void writeContractArenaAliases(std::stringstream &ss, const Contract& c, const GenContext& ctx) {
+	writeAliasBlock(ss, c, ctx, "arenaTypes", contractArenaBlockNameRef(c.name), "rpc::ArenaMany");
 }
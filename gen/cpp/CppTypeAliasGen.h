@@ -5,6 +5,10 @@
 
 #include <sstream>
 
-void writeContractTypeAliases(std::stringstream &ss, const Contract& c);
+struct GenContext;
+
+void writeContractTypeAliases(std::stringstream &ss, const Contract& c, const GenContext& ctx);
+void writeContractViewAliases(std::stringstream &ss, const Contract& c, const GenContext& ctx);
+void writeContractArenaAliases(std::stringstream &ss, const Contract& c, const GenContext& ctx);
 
 #endif /* GEN_CPP_CPPTYPEALIASGEN_H_ */
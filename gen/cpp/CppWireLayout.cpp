@@ -0,0 +1,278 @@
+#include "CppWireLayout.h"
+
+#include <algorithm>
+
+WireLayout::WireLayout(const Contract& c): bitflags(c.isAnnotated("bitflags")), varint(c.isAnnotated("varint"))
+{
+	for(const auto& i: c.items)
+	{
+		if(auto a = std::get_if<Contract::Alias>(&i.second))
+		{
+			aliases.emplace(a->name, a);
+		}
+	}
+}
+
+std::optional<size_t> WireLayout::primitiveSize(Contract::Primitive p)
+{
+	switch(p)
+	{
+	case Contract::Primitive::Bool: return 1;
+	case Contract::Primitive::I1: return 1;
+	case Contract::Primitive::U1: return 1;
+	case Contract::Primitive::I2: return 2;
+	case Contract::Primitive::U2: return 2;
+	case Contract::Primitive::I4: return 4;
+	case Contract::Primitive::U4: return 4;
+	case Contract::Primitive::I8: return 8;
+	case Contract::Primitive::U8: return 8;
+	case Contract::Primitive::String: return {};
+	default: throw std::runtime_error("unknown primitive type: " + std::to_string((int)p));
+	}
+}
+
+bool WireLayout::isFlag(const Contract::TypeRef& t) const
+{
+	if(auto p = std::get_if<Contract::Primitive>(&t))
+	{
+		return *p == Contract::Primitive::Bool;
+	}
+	else if(auto n = std::get_if<std::string>(&t))
+	{
+		const auto d = definition(*n);
+		return d && std::holds_alternative<Contract::Primitive>(*d) && std::get<Contract::Primitive>(*d) == Contract::Primitive::Bool;
+	}
+
+	return false;
+}
+
+static inline bool isWide(Contract::Primitive p) {
+	return p == Contract::Primitive::I4 || p == Contract::Primitive::U4 || p == Contract::Primitive::I8 || p == Contract::Primitive::U8;
+}
+
+bool WireLayout::isVarint(const Contract::TypeRef& t) const
+{
+	if(auto p = std::get_if<Contract::Primitive>(&t))
+	{
+		return varint && isWide(*p);
+	}
+
+	std::vector<std::string> path;
+
+	for(auto n = std::get_if<std::string>(&t); n;)
+	{
+		const auto it = aliases.find(*n);
+
+		if(it == aliases.end() || std::find(path.begin(), path.end(), *n) != path.end())
+		{
+			return false;
+		}
+
+		if(Contract::isAnnotated(it->second->annotations, "varint"))
+		{
+			return true;
+		}
+
+		path.push_back(*n);
+		const auto& d = it->second->type;
+
+		if(auto p = std::get_if<Contract::Primitive>(&d))
+		{
+			return varint && isWide(*p);
+		}
+
+		n = std::get_if<std::string>(&d);
+	}
+
+	return false;
+}
+
+std::vector<WireLayout::Group> WireLayout::groups(const Contract::Aggregate& a) const
+{
+	std::vector<Group> ret;
+
+	for(auto i = 0u; i < a.members.size();)
+	{
+		auto n = 1u;
+
+		if(bitflags)
+		{
+			while(i + n < a.members.size() && isFlag(a.members[i].type) && isFlag(a.members[i + n].type))
+			{
+				n++;
+			}
+		}
+
+		// A lone flag takes a whole byte either way, so it is left as a plain member.
+		ret.push_back({i, n, n > 1});
+		i += n;
+	}
+
+	return ret;
+}
+
+std::optional<size_t> WireLayout::resolve(const Contract::TypeDef& t, std::vector<std::string>& path, bool trivial) const
+{
+	if(auto p = std::get_if<Contract::Primitive>(&t))
+	{
+		if(varint && isWide(*p))
+		{
+			return {};
+		}
+
+		return primitiveSize(*p);
+	}
+	else if(auto a = std::get_if<Contract::Aggregate>(&t))
+	{
+		// An empty struct still takes a byte in memory, so it can not be laid out like on the wire.
+		if(trivial && a->members.empty())
+		{
+			return {};
+		}
+
+		size_t ret = 0;
+
+		for(const auto& g: groups(*a))
+		{
+			if(g.flags)
+			{
+				if(trivial)
+				{
+					return {};
+				}
+
+				ret += flagBytes(g.count);
+				continue;
+			}
+
+			const auto s = std::visit([this, &path, trivial](const auto& t){ return resolve(t, path, trivial); }, a->members[g.first].type);
+
+			if(!s)
+			{
+				return {};
+			}
+
+			ret += *s;
+		}
+
+		return ret;
+	}
+	else if(auto r = std::get_if<Contract::Array>(&t))
+	{
+		const auto& e = *r->elementType;
+		const auto d = std::holds_alternative<std::string>(e) ? definition(std::get<std::string>(e)) : nullptr;
+
+		// The elements are kept as they are (like those of collections), so integers are never varints here.
+		const auto p = d ? std::get_if<Contract::Primitive>(d) : std::get_if<Contract::Primitive>(&e);
+		const auto s = p ? primitiveSize(*p) : std::visit([this, &path, trivial](const auto& t){ return resolve(t, path, trivial); }, e);
+
+		if(!s)
+		{
+			return {};
+		}
+
+		return r->length * *s;
+	}
+	else if(auto n = std::get_if<std::string>(&t))
+	{
+		const auto it = aliases.find(*n);
+
+		// Unknown and self-containing types are left to be reported by the compiler.
+		if(it == aliases.end() || std::find(path.begin(), path.end(), *n) != path.end() || Contract::isAnnotated(it->second->annotations, "varint"))
+		{
+			return {};
+		}
+
+		path.push_back(*n);
+		const auto ret = resolve(it->second->type, path, trivial);
+		path.pop_back();
+		return ret;
+	}
+
+	return {};
+}
+
+std::optional<size_t> WireLayout::fixedSize(const Contract::TypeDef& t) const
+{
+	std::vector<std::string> path;
+	return resolve(t, path, false);
+}
+
+std::optional<size_t> WireLayout::trivialSize(const Contract::TypeDef& t) const
+{
+	std::vector<std::string> path;
+	return resolve(t, path, true);
+}
+
+size_t WireLayout::resolveAlignment(const Contract::TypeDef& t, std::vector<std::string>& path) const
+{
+	if(auto p = std::get_if<Contract::Primitive>(&t))
+	{
+		return primitiveSize(*p).value_or(8);
+	}
+	else if(std::holds_alternative<Contract::Collection>(t))
+	{
+		return 8;
+	}
+	else if(auto a = std::get_if<Contract::Aggregate>(&t))
+	{
+		size_t ret = 1;
+
+		for(const auto& m: a->members)
+		{
+			ret = std::max(ret, std::visit([this, &path](const auto& t){ return resolveAlignment(t, path); }, m.type));
+		}
+
+		return ret;
+	}
+	else if(auto r = std::get_if<Contract::Array>(&t))
+	{
+		return std::visit([this, &path](const auto& t){ return resolveAlignment(t, path); }, *r->elementType);
+	}
+	else if(auto n = std::get_if<std::string>(&t))
+	{
+		const auto it = aliases.find(*n);
+
+		if(it == aliases.end() || std::find(path.begin(), path.end(), *n) != path.end())
+		{
+			return 1;
+		}
+
+		path.push_back(*n);
+		const auto ret = resolveAlignment(it->second->type, path);
+		path.pop_back();
+		return ret;
+	}
+
+	return 1;
+}
+
+size_t WireLayout::alignment(const Contract::TypeDef& t) const
+{
+	std::vector<std::string> path;
+	return resolveAlignment(t, path);
+}
+
+const Contract::TypeDef* WireLayout::definition(const std::string& name) const
+{
+	std::vector<std::string> path{name};
+
+	for(auto it = aliases.find(name); it != aliases.end(); it = aliases.find(path.back()))
+	{
+		auto n = std::get_if<std::string>(&it->second->type);
+
+		if(!n)
+		{
+			return &it->second->type;
+		}
+
+		if(std::find(path.begin(), path.end(), *n) != path.end())
+		{
+			break;
+		}
+
+		path.push_back(*n);
+	}
+
+	return nullptr;
+}
@@ -0,0 +1,70 @@
+#ifndef RPC_TOOL_GEN_CPP_CPPWIRELAYOUT_H_
+#define RPC_TOOL_GEN_CPP_CPPWIRELAYOUT_H_
+
+#include "ast/Contract.h"
+
+#include <map>
+#include <optional>
+
+/*
+ * Resolves the wire size of the types of a contract that are serialized to the
+ * same number of bytes regardless of their value (i.e. contain no collections or strings).
+ *
+ * With the %bitflags annotation on the contract, runs of consecutive bool members of the
+ * aggregates go on the wire packed into the bits of as few bytes as possible.
+ *
+ * Integers of 4 and 8 bytes go on the wire as (zigzag) LEB128 varints if their alias or the
+ * whole contract is annotated with %varint. This applies to the values of members, arguments
+ * and return values, the elements of collections and arrays are kept as they are.
+ *
+ * Arrays have no length on the wire, so an array of fixed size elements is of fixed size too.
+ */
+class WireLayout
+{
+	std::map<std::string, const Contract::Alias*> aliases;
+	const bool bitflags, varint;
+
+	std::optional<size_t> resolve(const Contract::TypeDef& t, std::vector<std::string>& path, bool trivial) const;
+	size_t resolveAlignment(const Contract::TypeDef& t, std::vector<std::string>& path) const;
+
+public:
+	/// Consecutive members of an aggregate that are serialized together.
+	struct Group
+	{
+		size_t first, count;
+		bool flags;
+	};
+
+	WireLayout(const Contract& c);
+
+	/// The members of the aggregate in wire order, runs of flags are grouped (one member per group otherwise).
+	std::vector<Group> groups(const Contract::Aggregate& a) const;
+
+	/// Whether the value is a bool (possibly through aliases).
+	bool isFlag(const Contract::TypeRef& t) const;
+
+	/// Whether the value is encoded as a varint.
+	bool isVarint(const Contract::TypeRef& t) const;
+
+	/// Number of bytes a run of flags takes on the wire.
+	static inline size_t flagBytes(size_t count) {
+		return (count + 7) / 8;
+	}
+
+	/// Number of bytes the value takes on the wire, if it is the same for every value of the type.
+	std::optional<size_t> fixedSize(const Contract::TypeDef& t) const;
+
+	/// The fixed size, if the wire representation is also a valid in-memory one (i.e. there are no flag bits nor empty aggregates).
+	std::optional<size_t> trivialSize(const Contract::TypeDef& t) const;
+
+	/// The definition the named type ultimately refers to (following aliases of aliases).
+	const Contract::TypeDef* definition(const std::string& name) const;
+
+	/// Alignment of the generated C++ type in memory (collections and strings are assumed to be pointer aligned on a 64-bit target).
+	size_t alignment(const Contract::TypeDef& t) const;
+
+	/// Size of the integers (strings are length prefixed, so they have no fixed size).
+	static std::optional<size_t> primitiveSize(Contract::Primitive p);
+};
+
+#endif /* RPC_TOOL_GEN_CPP_CPPWIRELAYOUT_H_ */
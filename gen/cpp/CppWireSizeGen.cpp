@@ -0,0 +1,341 @@
+#include "CppWireSizeGen.h"
+
+#include "CppCommon.h"
+#include "CppWireLayout.h"
+
+/*
+ * Wire size of a sequence of values, split into the part known at generation time, the number
+ * of call references (which are sized by the runtime) and the terms that depend on the length
+ * of the collections in the actual value.
+ */
+struct WireSizeExpr
+{
+	size_t bytes = 0, calls = 0;
+	std::vector<std::string> terms;
+
+	inline bool isFixed() const {
+		return terms.empty();
+	}
+
+	std::string str() const
+	{
+		std::vector<std::string> parts;
+
+		if(bytes || (!calls && terms.empty()))
+		{
+			parts.push_back(std::to_string(bytes));
+		}
+
+		if(calls)
+		{
+			parts.push_back((calls > 1) ? (std::to_string(calls) + " * rpc::callWireSize") : "rpc::callWireSize");
+		}
+
+		parts.insert(parts.end(), terms.begin(), terms.end());
+
+		std::string ret;
+
+		for(auto i = 0u; i < parts.size(); i++)
+		{
+			ret += (i ? " + " : "") + parts[i];
+		}
+
+		return ret;
+	}
+};
+
+struct WireSizeGenerator
+{
+	const std::string pName;
+	const WireLayout& layout;
+
+	void add(WireSizeExpr& r, const Contract::Primitive& p, const std::string& v) const
+	{
+		if(const auto s = WireLayout::primitiveSize(p))
+		{
+			r.bytes += *s;
+		}
+		else
+		{
+			r.terms.push_back("rpc::collectionHeaderSize(" + v + ".size()) + " + v + ".size()");
+		}
+	}
+
+	void add(WireSizeExpr& r, const Contract::Collection& c, const std::string& v) const
+	{
+		if(const auto s = std::visit([this](const auto& t){ return layout.fixedSize(t); }, *c.elementType))
+		{
+			r.terms.push_back("rpc::collectionHeaderSize(" + v + ".size()) + " + v + ".size() * " + std::to_string(*s));
+		}
+		else
+		{
+			r.terms.push_back("sizeOf(" + v + ")");
+		}
+	}
+
+	/// Arrays have no length on the wire, only the elements are counted.
+	void add(WireSizeExpr& r, const Contract::Array& a, const std::string& v) const
+	{
+		if(const auto s = layout.fixedSize(a))
+		{
+			r.bytes += *s;
+		}
+		else
+		{
+			r.terms.push_back("sizeOf(" + v + ")");
+		}
+	}
+
+	void add(WireSizeExpr& r, const std::string& n, const std::string& v) const
+	{
+		if(const auto s = layout.fixedSize(n))
+		{
+			r.bytes += *s;
+		}
+		else if(auto d = layout.definition(n); d && std::holds_alternative<Contract::Collection>(*d))
+		{
+			add(r, std::get<Contract::Collection>(*d), v);
+		}
+		else
+		{
+			r.terms.push_back("sizeOf(" + v + ")");
+		}
+	}
+
+	/// Varint encoded values are sized by the runtime.
+	void add(WireSizeExpr& r, const Contract::Var& v, const std::string& name) const
+	{
+		if(layout.isVarint(v.type))
+		{
+			r.terms.push_back("rpc::varintSize(" + name + ")");
+		}
+		else
+		{
+			std::visit([this, &r, &name](const auto& t){ add(r, t, name); }, v.type);
+		}
+	}
+
+	WireSizeExpr sum(const std::vector<Contract::Var>& vs, const std::string& prefix, const size_t calls = 0) const
+	{
+		WireSizeExpr ret;
+		ret.calls = calls;
+
+		for(const auto& v: vs)
+		{
+			add(ret, v, prefix + ((prefix.length()) ? aggregateMemberName(v.name) : argumentName(v.name)));
+		}
+
+		return ret;
+	}
+
+	/// Like the arguments, except that the runs of flags are only counted by the bytes they are packed into.
+	WireSizeExpr sum(const Contract::Aggregate& a) const
+	{
+		WireSizeExpr ret;
+
+		for(const auto& g: layout.groups(a))
+		{
+			if(g.flags)
+			{
+				ret.bytes += WireLayout::flagBytes(g.count);
+			}
+			else
+			{
+				add(ret, a.members[g.first], "v." + aggregateMemberName(a.members[g.first].name));
+			}
+		}
+
+		return ret;
+	}
+
+	static inline std::string constant(const std::string& name, const WireSizeExpr& e, const int n) {
+		return indent(n) + "static constexpr size_t " + name + " = " + e.str() + ";";
+	}
+
+	/// Constant for the signatures of fixed size, otherwise a function of the arguments.
+	static inline std::string signature(const std::string& name, const std::vector<Contract::Var>& args, const WireSizeExpr& e, const int n)
+	{
+		if(e.isFixed())
+		{
+			return constant(name, e, n);
+		}
+
+		std::stringstream ss;
+		ss << indent(n) << "template<";
+
+		for(auto i = 0u; i < args.size(); i++)
+		{
+			ss << (i ? ", " : "") << "class A" << i;
+		}
+
+		ss << ">" << std::endl << indent(n) << "static inline size_t " << name << "(";
+
+		for(auto i = 0u; i < args.size(); i++)
+		{
+			ss << (i ? ", " : "") << "const A" << i << "& " << argumentName(args[i].name);
+		}
+
+		ss << ")" << std::endl;
+		ss << indent(n) << "{" << std::endl;
+		ss << indent(n + 1) << "return " << e.str() << ";" << std::endl;
+		ss << indent(n) << "}";
+		return ss.str();
+	}
+
+	template<class T>
+	void handleTypeDef(std::vector<std::string> &r, const std::string& name, const T&, const int n) const
+	{
+		if(const auto s = layout.fixedSize(name))
+		{
+			r.push_back(constant(userTypeName(name), WireSizeExpr{*s}, n));
+		}
+	}
+
+	void handleTypeDef(std::vector<std::string> &r, const std::string& name, const Contract::Aggregate& a, const int n) const
+	{
+		const auto e = sum(a);
+
+		if(e.isFixed())
+		{
+			r.push_back(constant(userTypeName(name), e, n));
+		}
+
+		std::stringstream ss;
+		ss << indent(n) << "template<template<class> class Collection>" << std::endl;
+		ss << indent(n) << "static " << (e.isFixed() ? "constexpr" : "inline") << " size_t sizeOf(const " << pName << "::" << userTypeName(name) << "<Collection>& " << (e.isFixed() ? "" : "v") << ")" << std::endl;
+		ss << indent(n) << "{" << std::endl;
+		ss << indent(n + 1) << "return " << (e.isFixed() ? userTypeName(name) : e.str()) << ";" << std::endl;
+		ss << indent(n) << "}";
+		r.push_back(ss.str());
+	}
+
+	void handleItem(std::vector<std::string> &r, const Contract::Alias &a, const int n) const {
+		std::visit([this, &r, &a, n](const auto& t){ handleTypeDef(r, a.name, t, n); }, a.type);
+	}
+
+	void handleItem(std::vector<std::string> &r, const Contract::Function &f, const int n) const
+	{
+		if(f.returnType)
+		{
+			const std::vector<Contract::Var> ret{{"retval", *f.returnType, ""}};
+			r.push_back(signature(callbackSignatureTypeName(f.name), ret, sum(ret, ""), n));
+			r.push_back(signature(functionSignatureTypeName(f.name), f.args, sum(f.args, "", 1), n));
+		}
+		else
+		{
+			r.push_back(signature(actionSignatureTypeName(f.name), f.args, sum(f.args, ""), n));
+		}
+	}
+
+	void handleItem(std::vector<std::string> &r, const Contract::Session &s, const int n) const
+	{
+		std::vector<std::string> result;
+		size_t fwd = 1, bwd = 1;
+
+		for(const auto& it: s.items)
+		{
+			if(auto f = std::get_if<Contract::Session::ForwardCall>(&it.second))
+			{
+				result.push_back(signature(sessionForwardCallSignatureTypeName(f->name), f->args, sum(f->args, ""), n + 1));
+				fwd++;
+			}
+			else if(auto cb = std::get_if<Contract::Session::CallBack>(&it.second))
+			{
+				result.push_back(signature(sessionCallbackSignatureTypeName(cb->name), cb->args, sum(cb->args, ""), n + 1));
+				bwd++;
+			}
+		}
+
+		result.push_back(constant(sessionCallExportTypeName(s.name), WireSizeExpr{0, fwd}, n + 1));
+		result.push_back(constant(sessionCallbackExportTypeName(s.name), WireSizeExpr{0, bwd}, n + 1));
+
+		for(const auto& it: s.items)
+		{
+			if(auto c = std::get_if<Contract::Session::Ctor>(&it.second))
+			{
+				std::vector<Contract::Var> ret;
+
+				if(c->returnType)
+				{
+					ret.push_back({"_retval", *c->returnType, ""});
+				}
+
+				// The exports are passed as a structure of call references.
+				result.push_back(signature(sessionAcceptSignatureTypeName(c->name), ret, sum(ret, "", fwd), n + 1));
+				result.push_back(signature(sessionCreateSignatureTypeName(c->name), c->args, sum(c->args, "", bwd + 1), n + 1));
+			}
+		}
+
+		std::stringstream ss;
+		writeBlock(ss, "struct " + sessionNamespaceName(s.name), result, n);
+		ss << ";";
+		r.push_back(ss.str());
+	}
+};
+
+void writeWireSizes(std::stringstream &ss, const Contract& c, const GenContext& ctx)
+{
+	const WireLayout layout(c);
+	const WireSizeGenerator gen{contractParametricBlockNameRef(c.name), layout};
+
+	std::vector<std::string> result = {
+		indent(1) + "template<class T>\n" +
+		indent(1) + "static constexpr std::enable_if_t<std::is_arithmetic_v<T>, size_t> sizeOf(const T&)\n" +
+		indent(1) + "{\n" +
+		indent(2) + "return sizeof(T);\n" +
+		indent(1) + "}",
+		indent(1) + "template<class C>\n" +
+		indent(1) + "static inline auto sizeOf(const C& c) -> decltype(c.size(), size_t{})\n" +
+		indent(1) + "{\n" +
+		indent(2) + "auto ret = rpc::collectionHeaderSize(c.size());\n\n" +
+		indent(2) + "for(const auto& e: c)\n" +
+		indent(2) + "{\n" +
+		indent(3) + "ret += sizeOf(e);\n" +
+		indent(2) + "}\n\n" +
+		indent(2) + "return ret;\n" +
+		indent(1) + "}"
+	};
+
+	if(usesType(c, [](const auto& t){ return std::holds_alternative<Contract::Array>(t); }))
+	{
+		result.push_back(
+			indent(1) + "template<class T, size_t N>\n" +
+			indent(1) + "static inline size_t sizeOf(const std::array<T, N>& a)\n" +
+			indent(1) + "{\n" +
+			indent(2) + "size_t ret = 0;\n\n" +
+			indent(2) + "for(const auto& e: a)\n" +
+			indent(2) + "{\n" +
+			indent(3) + "ret += sizeOf(e);\n" +
+			indent(2) + "}\n\n" +
+			indent(2) + "return ret;\n" +
+			indent(1) + "}"
+		);
+	}
+
+	// Strings are sized without going through their characters one by one.
+	if(usesType(c, [](const auto& t){ return std::holds_alternative<Contract::Primitive>(t) && std::get<Contract::Primitive>(t) == Contract::Primitive::String; }))
+	{
+		result.push_back(
+			indent(1) + "template<class C, class T, class A>\n" +
+			indent(1) + "static inline size_t sizeOf(const std::basic_string<C, T, A>& s)\n" +
+			indent(1) + "{\n" +
+			indent(2) + "return rpc::collectionHeaderSize(s.size()) + s.size() * sizeof(C);\n" +
+			indent(1) + "}"
+		);
+
+		result.push_back(
+			indent(1) + "template<class C, class T>\n" +
+			indent(1) + "static inline size_t sizeOf(const std::basic_string_view<C, T>& s)\n" +
+			indent(1) + "{\n" +
+			indent(2) + "return rpc::collectionHeaderSize(s.size()) + s.size() * sizeof(C);\n" +
+			indent(1) + "}"
+		);
+	}
+
+	const auto strs = renderItems(ctx, c, "wiresizes", [&gen](auto& r, const auto& i){
+		std::visit([&r, &gen](const auto& i){ gen.handleItem(r, i, 1); }, i.second);
+	});
+
+	result.insert(result.end(), strs.begin(), strs.end());
+	writeTopLevelBlock(ss, "struct " + contractWireSizesBlockNameRef(c.name), result);
+}
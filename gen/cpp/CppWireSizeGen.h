@@ -0,0 +1,12 @@
+#ifndef RPC_TOOL_GEN_CPP_CPPWIRESIZEGEN_H_
+#define RPC_TOOL_GEN_CPP_CPPWIRESIZEGEN_H_
+
+#include "ast/Contract.h"
+
+#include <sstream>
+
+struct GenContext;
+
+void writeWireSizes(std::stringstream &ss, const Contract& c, const GenContext& ctx);
+
+#endif /* RPC_TOOL_GEN_CPP_CPPWIRESIZEGEN_H_ */
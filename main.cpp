@@ -1,6 +1,18 @@
 #include "CliApp.h"
+#include "Serve.h"
+
+#include <cstdlib>
+#include <cstring>
 
 int main(int argc, const char* argv[])
 {
+	if(const char* socketPath = getenv(serverSocketVariable); socketPath && argc > 1 && std::strcmp(argv[1], "serve"))
+	{
+		if(const auto status = forwardToServer(socketPath, argc, argv))
+		{
+			return *status;
+		}
+	}
+
 	return CliApp::main(argc, argv);
 }
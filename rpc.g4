@@ -1,28 +1,31 @@
 grammar rpc;
 
 primitive:  kind=PRIMITIVE;
-collection: '[' WS* elementType=typeref WS* ']';
-typeref: p=primitive | c=collection | n=IDENTIFIER;
-var: WS* (docs=DOCS)? WS* name=IDENTIFIER VALSEP t=typeref  WS*;
+collection: '[' WS* elementType=typeref (DECLSEP '<=' WS* capacity=NUMBER)? WS* ']';
+array: '[' WS* elementType=typeref DECLSEP length=NUMBER WS* ']';
+typeref: p=primitive | c=collection | r=array | n=IDENTIFIER;
+var: WS* (docs=DOCS)? WS* name=IDENTIFIER VALSEP t=typeref (WS* annotations+=annotation)* WS*;
 varList: WS* vars+=var? (LISTSEP vars+=var)* WS* ;
 action: name=IDENTIFIER WS* '(' args=varList ')';
-function: call=action (VALSEP ret=typeref)?;
+function: call=action (VALSEP ret=typeref)? (WS* annotations+=annotation)*;
 
 aggregate:  '{' members=varList '}';
-typeAlias: name=IDENTIFIER NAMEVALSEP (p=primitive | a=aggregate | c=collection | n=IDENTIFIER);
+annotation: '%' name=IDENTIFIER ('(' WS* value=NUMBER WS* ')')?;
+typeAlias: name=IDENTIFIER NAMEVALSEP (p=primitive | a=aggregate | c=collection | r=array | n=IDENTIFIER) (WS* annotations+=annotation)*;
 
-fwdCall: '!' WS* sym=action;
-callBack: '@' WS* sym=action;
+fwdCall: '!' WS* sym=action (WS* annotations+=annotation)*;
+callBack: '@' WS* sym=action (WS* annotations+=annotation)*;
 sessionItem: WS* (docs=DOCS)? WS* (fwd=fwdCall | bwd=callBack | ctr=function) WS* ;
 session: name=IDENTIFIER WS* '<' WS* items+=sessionItem (DECLSEP+ (items+=sessionItem)? WS*)*? '>';
 
-contract: '$' WS* name=IDENTIFIER;
+contract: '$' WS* name=IDENTIFIER (WS* annotations+=annotation)*;
 
 item: WS* (docs=DOCS)? WS* (cont=contract | func=function | alias=typeAlias | sess=session) WS*;
 rpc: items+=item (DECLSEP+ (items+=item | EOF))*;
 
 PRIMITIVE:      ([IiUu][1248]|'bool');
 IDENTIFIER:     [a-zA-Z][_a-zA-Z0-9]*;
+NUMBER:         [0-9]+;
 DOCS:			'/*' .*? '*/';
 LISTSEP: 		WS* ',' WS*;
 VALSEP:      	WS* ':' WS*;
@@ -0,0 +1,331 @@
+#include "Fixtures.h"
+
+using C = Contract;
+using P = Contract::Primitive;
+
+static inline C::TypeRef named(const std::string& n) {
+	return n;
+}
+
+static inline C::Collection many(const C::TypeRef& t) {
+	return C::Collection{std::make_shared<C::TypeRef>(t)};
+}
+
+static inline C::Collection bounded(const C::TypeRef& t, size_t n) {
+	return C::Collection{std::make_shared<C::TypeRef>(t), n};
+}
+
+static inline C::Array array(const C::TypeRef& t, size_t n) {
+	return C::Array{std::make_shared<C::TypeRef>(t), n};
+}
+
+static inline C::Aggregate aggregate(std::vector<C::Var> members) {
+	return C::Aggregate{std::move(members)};
+}
+
+static inline C::Var var(const std::string& n, const C::TypeRef& t, std::vector<C::Annotation> as = {}) {
+	return C::Var(n, t, "", std::move(as));
+}
+
+static inline C::Item alias(const std::string& n, const C::TypeDef& t, std::vector<C::Annotation> as = {}) {
+	return {"", C::Alias(n, t, std::move(as))};
+}
+
+static inline C::Item session(const std::string& n, std::vector<C::Session::Item> items) {
+	return {"", C::Session{n, std::move(items)}};
+}
+
+static inline C::Session::Item ctor(const std::string& n, std::vector<C::Var> args, std::optional<C::TypeRef> ret = {}, std::vector<C::Annotation> as = {}) {
+	return {"", C::Session::Ctor(C::Function(C::Action{n, std::move(args), std::move(as)}, ret))};
+}
+
+static inline C::Session::Item forward(const std::string& n, std::vector<C::Var> args, std::vector<C::Annotation> as = {}) {
+	return {"", C::Session::ForwardCall(C::Action{n, std::move(args), std::move(as)})};
+}
+
+static inline C::Session::Item callback(const std::string& n, std::vector<C::Var> args, std::vector<C::Annotation> as = {}) {
+	return {"", C::Session::CallBack(C::Action{n, std::move(args), std::move(as)})};
+}
+
+static inline C::Item function(const std::string& n, std::vector<C::Var> args, std::optional<C::TypeRef> ret = {}, std::vector<C::Annotation> as = {}) {
+	return {"", C::Function(C::Action{n, std::move(args), std::move(as)}, ret)};
+}
+
+/// Aggregates of fixed size (also nested in each other), one of variable size and ones that can not be packed.
+static inline Fixture packed()
+{
+	return {"packed", {Contract{{
+		alias("Point", aggregate({var("x", P::I4), var("y", P::U2), var("visible", P::Bool), var("stamp", P::U8)})),
+		alias("Segment", aggregate({var("from", named("Point")), var("to", named("Point"))})),
+		alias("Label", aggregate({var("text", many(P::I1)), var("at", named("Point"))})),
+		alias("Empty", aggregate({})),
+		alias("Tagged", aggregate({var("tag", named("Empty")), var("at", named("Point"))})),
+		function("move", {var("s", named("Segment")), var("l", named("Label"))}, named("Point")),
+	}, "packed", "Fixed size aggregates laid out like on the wire"}}, [](auto& o){
+		o.packed = true;
+	}};
+}
+
+/// Server proxy looking up its methods in a switch over their numeric identifiers, plain and session ones alike.
+static inline Fixture dispatch()
+{
+	return {"dispatch", {Contract{{
+		alias("Request", aggregate({var("id", P::U4), var("body", many(P::U1))})),
+		function("handle", {var("r", named("Request"))}, P::Bool),
+		function("reset", {}),
+		session("Log", {
+			ctor("open", {var("level", P::U1)}, P::U4),
+			forward("append", {var("line", many(P::U1))}),
+			callback("flushed", {var("count", P::U4)}),
+		}),
+	}, "dispatch", "Statically dispatched service"}}, [](auto& o){
+		o.doService = o.staticDispatch = o.numericIds = true;
+	}};
+}
+
+/// Client proxy sharing its links through a table, with plain calls and a session.
+static inline Fixture links()
+{
+	return {"links", {Contract{{
+		alias("Query", aggregate({var("key", P::U4), var("prefix", many(P::U1))})),
+		function("find", {var("q", named("Query"))}, many(P::U4)),
+		function("ping", {}),
+		session("Watch", {
+			ctor("watch", {var("q", named("Query"))}, P::U4),
+			forward("cancel", {}),
+			callback("changed", {var("key", P::U4)}),
+		}),
+	}, "links", "Client on shared links"}}, [](auto& o){
+		o.doClient = o.sharedLinks = true;
+	}};
+}
+
+/// Sessions exporting their methods through a table per type, on both sides.
+static inline Fixture exports()
+{
+	return {"exports", {Contract{{
+		session("Transfer", {
+			ctor("upload", {var("name", many(P::U1)), var("size", P::U8)}, P::U4),
+			ctor("resume", {var("id", P::U4)}),
+			forward("chunk", {var("data", many(P::U1))}),
+			forward("finish", {}),
+			callback("progress", {var("done", P::U8)}),
+			callback("failed", {var("code", P::I2)}),
+		}),
+	}, "exports", "Sessions with exports tables"}}, [](auto& o){
+		o.doClient = o.doService = o.staticExports = true;
+	}};
+}
+
+/// Views of the serialized form, with fields at known and unknown offsets.
+static inline Fixture accessors()
+{
+	return {"accessors", {Contract{{
+		alias("Level", P::U1),
+		alias("Point", aggregate({var("x", P::I4), var("y", P::U2), var("visible", P::Bool), var("level", named("Level"))})),
+		alias("Shape", aggregate({var("origin", named("Point")), var("points", many(named("Point"))), var("closed", P::Bool), var("tail", P::I2)})),
+		function("draw", {var("s", named("Shape")), var("at", named("Point"))}, P::Bool),
+		function("clear", {}),
+		session("View", {
+			ctor("open", {var("from", named("Point"))}, P::U4),
+			forward("move", {var("to", named("Point"))}),
+			callback("moved", {var("ok", P::Bool)}),
+		}),
+	}, "accessors", "Readers of the wire format"}}, [](auto& o){
+		o.accessors = true;
+	}};
+}
+
+/// Wire order writers for aggregates, calls and sessions.
+static inline Fixture builders()
+{
+	return {"builders", {Contract{{
+		alias("Origin", aggregate({var("x", P::U2), var("valid", P::Bool)})),
+		alias("Packet", aggregate({var("origin", named("Origin")), var("kind", P::U1), var("payload", many(P::U1)), var("chunks", many(many(P::U1))), var("routes", many(named("Origin")))})),
+		alias("Packets", many(named("Packet"))),
+		alias("Names", aggregate({var("put", P::U1), var("putFlag", P::Bool), var("reserve", many(P::U1)), var("nest", named("Origin")), var("fieldCount", P::U2)})),
+		function("send", {var("p", named("Packet")), var("more", named("Packets"))}, P::Bool),
+		function("drop", {var("id", P::U4)}),
+		session("Channel", {
+			ctor("connect", {var("from", named("Origin"))}),
+			forward("post", {var("p", named("Packet"))}),
+			callback("received", {var("count", P::U4)}),
+		}),
+	}, "builders", "Writers of the wire format"}}, [](auto& o){
+		o.builders = true;
+	}};
+}
+
+/// Serializers written out member by member, for aggregates of every shape and the exports of a session.
+static inline Fixture unrolled()
+{
+	return {"unrolled", {Contract{{
+		alias("Sample", aggregate({var("value", P::I2), var("valid", P::Bool)})),
+		alias("Series", aggregate({var("first", named("Sample")), var("rest", many(named("Sample"))), var("name", many(P::U1))})),
+		alias("Nothing", aggregate({})),
+		alias("Wrapped", aggregate({var("none", named("Nothing")), var("count", P::U2)})),
+		function("record", {var("s", named("Series"))}, named("Sample")),
+		session("Stream", {
+			ctor("open", {var("from", named("Sample"))}, P::U4),
+			forward("push", {var("s", named("Sample"))}),
+			callback("pushed", {var("count", P::U4)}),
+		}),
+	}, "unrolled", "Serializers unrolled by the generator"}}, [](auto& o){
+		o.unrolledSerdes = true;
+	}};
+}
+
+/// Structure-of-arrays containers, with fixed and variable size members.
+static inline Fixture columns()
+{
+	return {"columns", {Contract{{
+		alias("Reading", aggregate({var("sensor", P::U2), var("valid", P::Bool), var("unit", many(P::U1)), var("value", P::I8)})),
+		alias("Single", aggregate({var("only", P::Bool)})),
+		alias("Nothing", aggregate({})),
+		function("report", {var("rs", many(named("Reading"))), var("ss", many(named("Single"))), var("ns", many(named("Nothing")))}),
+	}, "columns", "Collections of aggregates decoded into columns"}}, [](auto& o){
+		o.columns = true;
+	}};
+}
+
+/// Members declared in the order of the least padding, still written in the order of the contract.
+static inline Fixture reorder()
+{
+	return {"reorder", {Contract{{
+		alias("Mixed", aggregate({var("flag", P::Bool), var("stamp", P::U8), var("code", P::U2), var("ok", P::Bool), var("count", P::U4)})),
+		alias("Nested", aggregate({var("small", P::U1), var("mixed", named("Mixed")), var("tail", many(P::U2)), var("id", P::I4)})),
+		function("submit", {var("n", named("Nested"))}),
+	}, "reorder", "Aggregates with reordered members"}}, [](auto& o){
+		o.reorderMembers = true;
+	}};
+}
+
+/// Runs of flags packed into bits, read and written in every form the wire layout is generated for.
+static inline Fixture bitflags()
+{
+	return {"bitflags", {Contract{{
+		alias("Status", aggregate({var("ready", P::Bool), var("busy", P::Bool), var("code", P::U2), var("lone", P::Bool), var("tail", many(P::U1)),
+			var("a", P::Bool), var("b", P::Bool), var("c", P::Bool), var("d", P::Bool), var("e", P::Bool), var("f", P::Bool), var("g", P::Bool), var("h", P::Bool), var("i", P::Bool)})),
+		alias("Pair", aggregate({var("on", P::Bool), var("off", P::Bool)})),
+		alias("Names", aggregate({var("field", P::U1), var("flag", P::Bool), var("other", P::Bool), var("wireSize", P::U2)})),
+		function("update", {var("s", many(named("Status"))), var("p", named("Pair"))}, P::Bool),
+	}, "bitflags", "Flags packed into bits", {{"bitflags"}}}}, [](auto& o){
+		o.accessors = o.builders = o.columns = true;
+	}};
+}
+
+/// Varint encoded integers, directly and through an alias, in the aggregates, the signatures and a session.
+static inline Fixture varint()
+{
+	return {"varint", {Contract{{
+		alias("Id", P::U4),
+		alias("Entry", aggregate({var("id", named("Id")), var("small", P::U1), var("delta", P::I8), var("on", P::Bool), var("off", P::Bool)})),
+		alias("Ids", many(named("Id"))),
+		function("lookup", {var("id", named("Id")), var("ids", named("Ids")), var("entries", many(named("Entry")))}, P::I4),
+		session("Cursor", {
+			ctor("open", {var("from", P::U8)}, named("Id")),
+			forward("seek", {var("to", P::I2)}),
+			callback("at", {var("position", P::U8)}),
+		}),
+	}, "varint", "Integers encoded by magnitude", {{"varint"}, {"bitflags"}}}}, [](auto& o){
+		o.explicitInstantiation = o.unrolledSerdes = o.columns = true;
+	}};
+}
+
+/// Arrays of fixed and variable size elements, nested in each other and laid out like on the wire if possible.
+static inline Fixture arrays()
+{
+	return {"arrays", {Contract{{
+		alias("Vector", array(P::I2, 3)),
+		alias("Pose", aggregate({var("position", named("Vector")), var("rotation", array(array(P::I1, 2), 2))})),
+		alias("Track", aggregate({var("poses", array(named("Pose"), 4)), var("names", array(many(P::U1), 2)), var("id", P::U4)})),
+		function("follow", {var("t", named("Track")), var("via", array(named("Vector"), 2))}, array(P::U4, 2)),
+	}, "arrays", "Fixed length arrays"}}, [](auto& o){
+		o.packed = o.wireSizes = o.accessors = true;
+	}};
+}
+
+/// Collections with a maximum number of elements, stored inline, in every place they can appear.
+static inline Fixture bounded()
+{
+	return {"bounded", {Contract{{
+		alias("Name", bounded(P::U1, 16)),
+		alias("Tag", aggregate({var("name", named("Name")), var("values", bounded(P::I4, 3))})),
+		alias("Tags", bounded(named("Tag"), 8)),
+		alias("Group", aggregate({var("tags", named("Tags")), var("aliases", many(named("Name"))), var("nested", bounded(bounded(P::U2, 2), 2))})),
+		function("label", {var("g", named("Group")), var("extra", bounded(named("Name"), 4))}, named("Tags")),
+	}, "bounded", "Bounded collections"}}, [](auto& o){
+		o.wireSizes = o.builders = o.accessors = true;
+	}};
+}
+
+/// Strings stored as the kind that goes with the collection, sized, read and written without going through their characters.
+static inline Fixture strings()
+{
+	return {"strings", {Contract{{
+		alias("Text", P::String),
+		alias("Person", aggregate({var("name", named("Text")), var("nicknames", many(P::String)), var("initials", array(P::String, 2)), var("age", P::U1)})),
+		function("greet", {var("who", named("Person")), var("greeting", P::String)}, P::String),
+		session("Chat", {
+			ctor("join", {var("nick", P::String)}, named("Text")),
+			forward("say", {var("line", P::String)}),
+			callback("heard", {var("from", named("Text")), var("line", P::String)}),
+		}),
+	}, "strings", "Strings"}}, [](auto& o){
+		o.views = o.wireSizes = o.accessors = o.builders = true;
+	}};
+}
+
+/// Usage hints on aliases, members, arguments and calls of every kind, some of them with an argument.
+static inline Fixture hints()
+{
+	return {"hints", {Contract{{
+		alias("Blob", many(P::U1), {{"bulk"}, {"maxsize", 4096}}),
+		alias("Record", aggregate({var("id", P::U4), var("data", many(P::U1), {{"bulk"}}), var("tags", many(P::U2), {{"maxsize", 8}})})),
+		function("store", {var("r", named("Record")), var("extra", named("Blob"), {{"maxsize", 1024}})}, P::Bool, {{"hot"}, {"idempotent"}}),
+		function("flush", {}, {}, {{"batchable"}, {"maxsize", 64}}),
+		session("Feed", {
+			ctor("subscribe", {var("from", P::U8)}, P::U4, {{"hot"}}),
+			forward("push", {var("chunk", named("Blob"), {{"bulk"}})}, {{"maxsize", 512}}),
+			callback("delivered", {var("count", P::U4)}, {{"hot"}}),
+		}),
+	}, "hints", "Usage hints"}}, [](auto&){}};
+}
+
+/// Module interface with an instantiation unit, named explicitly instead of after the output.
+static inline Fixture modules()
+{
+	return {"modules", {Contract{{
+		alias("Point", aggregate({var("x", P::I4), var("y", P::I4)})),
+		function("locate", {var("p", named("Point"))}, P::U4),
+		session("Tracker", {
+			ctor("track", {var("from", named("Point"))}),
+			callback("moved", {var("to", named("Point"))}),
+		}),
+	}, "modules", "Module interface"}}, [](auto& o){
+		o.module = o.explicitInstantiation = true;
+		o.name = "Geometry";
+	}};
+}
+
+std::vector<Fixture> fixtures()
+{
+	return {
+		packed(),
+		dispatch(),
+		links(),
+		exports(),
+		accessors(),
+		builders(),
+		unrolled(),
+		columns(),
+		reorder(),
+		bitflags(),
+		varint(),
+		arrays(),
+		bounded(),
+		strings(),
+		hints(),
+		modules(),
+	};
+}
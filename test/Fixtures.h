@@ -0,0 +1,23 @@
+#ifndef RPC_TOOL_TEST_FIXTURES_H_
+#define RPC_TOOL_TEST_FIXTURES_H_
+
+#include "ast/Contract.h"
+#include "gen/Generator.h"
+
+#include <functional>
+
+/*
+ * A contract along with the generator options it is checked with. The expected
+ * output is kept under the name of the fixture, along with the contract itself
+ * in textual form, so that the two can be reviewed together.
+ */
+struct Fixture
+{
+	std::string name;
+	std::vector<Contract> ast;
+	std::function<void(GeneratorOptions&)> configure;
+};
+
+std::vector<Fixture> fixtures();
+
+#endif /* RPC_TOOL_TEST_FIXTURES_H_ */
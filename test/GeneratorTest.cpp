@@ -0,0 +1,125 @@
+#include "Fixtures.h"
+
+#include "ast/ContractFormatter.h"
+#include "ast/ContractTextCodec.h"
+
+#include <fstream>
+#include <sstream>
+#include <iostream>
+#include <iterator>
+#include <filesystem>
+
+/*
+ * Runs the generator on the fixtures and compares the output to the expected one
+ * kept in the specified directory, or overwrites the expected output if invoked
+ * with --update (so that the changes can be reviewed in the diff).
+ */
+static inline bool check(const std::filesystem::path& path, const std::string& actual, bool update)
+{
+	if(update)
+	{
+		std::ofstream output(path, std::ios::binary);
+
+		if(!(output << actual))
+		{
+			throw std::runtime_error("Expected output '" + path.string() + "' could not be written");
+		}
+
+		return true;
+	}
+
+	std::ifstream input(path, std::ios::binary);
+
+	if(!input)
+	{
+		std::cerr << path.string() << ": missing (run with --update to create it)" << std::endl;
+		return false;
+	}
+
+	const std::string expected(std::istreambuf_iterator<char>(input), {});
+
+	if(expected == actual)
+	{
+		return true;
+	}
+
+	std::istringstream e(expected), a(actual);
+	std::string el, al;
+
+	for(int line = 1; ; line++)
+	{
+		const bool ge = (bool)std::getline(e, el), ga = (bool)std::getline(a, al);
+
+		if(!ge || !ga || el != al)
+		{
+			std::cerr << path.string() << ":" << line << ": expected '" << (ge ? el : "<end of file>") << "', got '" << (ga ? al : "<end of file>") << "'" << std::endl;
+			return false;
+		}
+	}
+}
+
+static inline bool run(const Fixture& f, const std::filesystem::path& dir, bool update)
+{
+	bool ok = true;
+
+	FormatOptions fo;
+	fo.colored = false;
+	ok = check(dir / (f.name + ".rcd"), format(fo, f.ast), update) && ok;
+
+	// The return types of the calls are not compared by the contract, so the serialized forms are compared too.
+	const auto text = serializeText(f.ast);
+	std::istringstream serialized(text);
+	const auto restored = deserializeText(serialized);
+
+	if(!(restored == f.ast) || serializeText(restored) != text)
+	{
+		std::cerr << f.name << ": contract changed through serialization" << std::endl;
+		ok = false;
+	}
+
+	GeneratorOptions opts;
+	f.configure(opts);
+
+	const auto header = f.name + ".h";
+	ok = check(dir / header, opts.invokeGenerator(f.ast, header), update) && ok;
+
+	if(opts.explicitInstantiation)
+	{
+		ok = check(dir / (f.name + ".cpp"), opts.language->generateInstantiations(f.ast, opts.resolveName(f.ast, header), header, opts), update) && ok;
+	}
+
+	return ok;
+}
+
+int main(int argc, const char* argv[])
+{
+	if(argc < 2 || (argc > 2 && std::string(argv[2]) != "--update"))
+	{
+		std::cerr << "Usage: " << argv[0] << " <expected output directory> [--update]" << std::endl;
+		return -1;
+	}
+
+	const std::filesystem::path dir(argv[1]);
+	const bool update = argc > 2;
+	int failures = 0;
+
+	for(const auto& f: fixtures())
+	{
+		bool ok;
+
+		try
+		{
+			ok = run(f, dir, update);
+		}
+		catch(const std::exception& e)
+		{
+			std::cerr << f.name << ": " << e.what() << std::endl;
+			ok = false;
+		}
+
+		std::cout << (ok ? "PASS " : "FAIL ") << f.name << std::endl;
+		failures += !ok;
+	}
+
+	return failures ? 1 : 0;
+}
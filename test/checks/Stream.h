@@ -0,0 +1,83 @@
+#ifndef RPC_TOOL_TEST_CHECKS_STREAM_H_
+#define RPC_TOOL_TEST_CHECKS_STREAM_H_
+
+#include <vector>
+#include <cstring>
+#include <cstdint>
+#include <optional>
+#include <iostream>
+
+using Bytes = std::vector<uint8_t>;
+
+/// Byte buffer the checks serialize into, then deserialize from.
+struct Stream
+{
+	Bytes data;
+	size_t position = 0;
+
+	inline bool write(const void* d, size_t length)
+	{
+		data.insert(data.end(), (const uint8_t*)d, (const uint8_t*)d + length);
+		return true;
+	}
+
+	/// The last byte written (the builders set the flags in it).
+	inline uint8_t& back() {
+		return data.back();
+	}
+
+	inline bool read(void* d, size_t length)
+	{
+		if(data.size() - position < length)
+		{
+			return false;
+		}
+
+		memcpy(d, data.data() + position, length);
+		position += length;
+		return true;
+	}
+};
+
+static int failures = 0;
+
+/// Reports the failed condition, the check goes on with the rest of them.
+#define CHECK(...) ((__VA_ARGS__) ? (void)0 : (std::cerr << __FILE__ << ":" << __LINE__ << ": check failed: " << #__VA_ARGS__ << std::endl, (void)failures++))
+
+/// The value as it goes on the wire, none if it could not be written or its size is off.
+template<class T> inline std::optional<Bytes> encode(const T& v)
+{
+	Stream s;
+
+	if(!rpc::TypeInfo<T>::write(s, v) || s.data.size() != rpc::TypeInfo<T>::size(v))
+	{
+		return {};
+	}
+
+	return s.data;
+}
+
+/// The values one after the other, like the arguments of a call.
+template<class... T> inline Bytes arguments(const T&... v)
+{
+	Stream s;
+	(rpc::TypeInfo<T>::write(s, v), ...);
+	return s.data;
+}
+
+/// Reads the value, which has to take exactly the specified bytes.
+template<class T> inline bool decode(const Bytes& b, T& v)
+{
+	Stream s{b};
+	return rpc::TypeInfo<T>::read(s, v) && s.position == b.size();
+}
+
+/// Whether the value reads back the same (compared as written, so that any type can be checked).
+template<class T> inline bool roundTrip(const T& v)
+{
+	const auto b = encode(v);
+	T r{};
+	return b && decode(*b, r) && encode(r) == b;
+}
+
+#endif /* RPC_TOOL_TEST_CHECKS_STREAM_H_ */
@@ -0,0 +1,36 @@
+#include "accessors.h"
+#include "Stream.h"
+
+using T = AccessorsContract::Types;
+using A = AccessorsContract::Accessors;
+
+// The offsets of the fields are checked by the stub, these are the sizes of the records of fixed size.
+static_assert(A::Point::wireSize == A::Point::fixedSize);
+static_assert(A::DrawCallback::wireSize == A::DrawCallback::fixedSize);
+static_assert(A::ClearCall::wireSize == A::ClearCall::fixedSize);
+static_assert(A::ViewSession::MoveCall::wireSize == A::ViewSession::MoveCall::fixedSize);
+static_assert(A::ViewSession::MovedCallback::wireSize == A::ViewSession::MovedCallback::fixedSize);
+
+int main()
+{
+	const T::Point p{-5, 300, true, 7};
+	const T::Shape s{p, {{1, 2, false, 3}, {4, 5, true, 6}}, true, -1234};
+
+	CHECK(encode(p)->size() == A::Point::wireSize);
+
+	// The fields read from where the serializers put them, also the ones behind a collection.
+	const auto b = *encode(s);
+	const A::Shape a(b.data());
+	CHECK(a.origin().x() == -5 && a.origin().y() == 300 && a.origin().visible() && a.origin().level() == 7);
+	CHECK(a.points().size() == 2 && a.points()[1].x() == 4 && a.points()[1].visible());
+	CHECK(a.closed() && a.tail() == -1234);
+	CHECK(a.length() == b.size());
+
+	const auto d = arguments(s, p, rpc::Call<>{42});
+	CHECK(A::DrawFunction(d.data()).at().y() == 300 && A::DrawFunction(d.data()).callback().id() == 42);
+
+	const auto c = arguments(p, T::ViewSession::ViewCallbackExports{{1}, {2}}, rpc::Call<>{3});
+	const A::ViewSession::OpenCreate o(c.data());
+	CHECK(o.from().level() == 7 && o._exports().id(1) == 2 && o._accept().id() == 3);
+	return failures;
+}
@@ -0,0 +1,36 @@
+#include "arrays.h"
+#include "Stream.h"
+
+using T = ArraysContract::Types;
+using W = ArraysContract::WireSizes;
+using A = ArraysContract::Accessors;
+
+// Arrays of fixed size elements are of fixed size, so the aggregates made up of them are packed.
+static_assert(sizeof(T::Vector) == W::Vector);
+static_assert(sizeof(T::Pose) == W::Pose);
+static_assert(rpc::TypeInfo<T::Pose>::size({}) == W::Pose);
+static_assert(W::sizeOf(T::Pose{}) == W::Pose);
+static_assert(A::Pose::wireSize == W::Pose);
+static_assert(rpc::TypeInfo<std::array<uint32_t, 2>>::size({}) == W::FollowCallback);
+
+int main()
+{
+	// Elements one after the other, without a header.
+	const T::Pose p{{1, 2, 3}, {{{4, 5}, {6, 7}}}};
+	CHECK(encode(p) == Bytes({0x01, 0x00, 0x02, 0x00, 0x03, 0x00, 0x04, 0x05, 0x06, 0x07}));
+
+	const T::Track t{{p, p, {{8, 9, 10}, {}}, p}, {{{1, 2}, {3}}}, 0x11223344};
+	const auto b = encode(t);
+	CHECK(roundTrip(t));
+	CHECK(W::sizeOf(t) == b->size());
+
+	const A::Track a(b->data());
+	CHECK(a.poses()[2].position()[1] == 9 && a.poses()[3].rotation()[1][0] == 6);
+	CHECK(a.names()[1].size() == 1 && a.id() == 0x11223344 && a.length() == b->size());
+
+	const std::array<T::Vector, 2> via{{{1, 2, 3}, {4, 5, 6}}};
+	const auto f = arguments(t, via, rpc::Call<std::array<uint32_t, 2>>{1});
+	CHECK(W::FollowFunction(t, via) == f.size());
+	CHECK(A::FollowFunction(f.data()).via()[1][2] == 6);
+	return failures;
+}
@@ -0,0 +1,54 @@
+#include "bitflags.h"
+#include "Stream.h"
+
+#include <type_traits>
+
+using T = BitflagsContract::Types;
+using A = BitflagsContract::Accessors;
+using B = BitflagsContract::Builders;
+using C = BitflagsContract::Columns;
+
+// The runs take a byte per eight flags, a lone flag is not packed.
+static_assert(A::Status::offset<4>() == rpc::variableSize && A::Pair::wireSize == 1);
+static_assert(rpc::TypeInfo<T::Pair>::size({}) == 1);
+static_assert(A::Names::wireSize == 4);
+
+template<class Last, class Builder> constexpr bool finishes(Builder&&) {
+	return std::is_same_v<std::decay_t<Builder>, Last>;
+}
+
+int main()
+{
+	const T::Status s{true, false, 0x0102, true, {7}, true, false, false, false, false, false, false, true, true};
+	const auto b = encode(s);
+	CHECK(b == Bytes({0x01, 0x02, 0x01, 0x01, 0x01, 0x07, 0x81, 0x01}));
+
+	// The accessors pick the bits from where the serializers put them.
+	const A::Status a(b->data());
+	CHECK(a.ready() && !a.busy() && a.code() == 0x0102 && a.lone() && a.tail().size() == 1);
+	CHECK(a.a() && !a.b() && a.h() && a.i());
+
+	// The builders set them the same way.
+	Stream t;
+	auto a0 = B::Status<Stream>(t).ready(s.ready).busy(s.busy).code(s.code).lone(s.lone).tail(1);
+	t.write(s.tail.data(), 1);
+	CHECK(finishes<B::Status<Stream, 14>>(std::move(a0).a(s.a).b(s.b).c(s.c).d(s.d).e(s.e).f(s.f).g(s.g).h(s.h).i(s.i)));
+	CHECK(t.data == b);
+
+	// So do the columns, reading them back bit by bit.
+	const rpc::Many<T::Status> rows{s, {false, true, 3, false, {}, false, true, false, false, false, false, false, false, false}};
+	C::Status<rpc::Many> c;
+	CHECK(decode(*encode(rows), c) && c.busy[1] && !c.ready[1] && c.i[0] && !c.i[1]);
+	CHECK(encode(c) == encode(rows));
+
+	const auto u = arguments(rows, T::Pair{false, true}, rpc::Call<bool>{1});
+	const A::UpdateFunction f(u.data());
+	CHECK(f.s().size() == 2 && f.s()[1].b() && f.p().off() && !f.p().on() && f.callback().id() == 1);
+
+	// Fields named like the members of the record are read through renamed accessors.
+	const auto n = *encode(T::Names{9, false, true, 0x0304});
+	const A::Names r(n.data());
+	CHECK(n == Bytes({0x09, 0x02, 0x04, 0x03}));
+	CHECK(r._field() == 9 && !r._flag() && r.other() && r._wireSize() == 0x0304);
+	return failures;
+}
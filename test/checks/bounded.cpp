@@ -0,0 +1,77 @@
+#include "bounded.h"
+#include "Stream.h"
+
+#include <type_traits>
+
+using T = BoundedContract::Types;
+using W = BoundedContract::WireSizes;
+using A = BoundedContract::Accessors;
+using B = BoundedContract::Builders;
+
+// Bounded collections are stored inline, whatever collection the types are instantiated with.
+static_assert(std::is_same_v<decltype(T::Tag::values), rpc::InlineMany<int32_t, 3>>);
+static_assert(std::is_same_v<BoundedContract::Parametric::Tags<rpc::Many>, rpc::InlineMany<BoundedContract::Parametric::Tag<rpc::Many>, 8>>);
+static_assert(std::is_same_v<decltype(T::Group::aliases), rpc::Many<T::Name>>);
+
+// They go on the wire like the unbounded ones, so their size depends on the number of elements.
+static_assert(rpc::TypeInfo<T::Name>::sgn == rpc::TypeInfo<rpc::Many<uint8_t>>::sgn);
+static_assert(A::Tag::fixedSize == rpc::variableSize);
+
+template<class Last, class Builder> constexpr bool finishes(Builder&&) {
+	return std::is_same_v<std::decay_t<Builder>, Last>;
+}
+
+/// Writes the tag through its builder, the elements of the collections after their headers.
+static inline void build(Stream& s, const T::Tag& t)
+{
+	auto values = B::Tag<Stream>(s).name(t.name.size());
+	s.write(t.name.begin(), t.name.size());
+	CHECK(finishes<B::Tag<Stream, 2>>(std::move(values).values(t.values.size())));
+	s.write(t.values.begin(), 4 * t.values.size());
+}
+
+int main()
+{
+	const T::Tag tag{{'a', 'b'}, {1, -2, 3}};
+	const T::Group g{{tag, {{'c'}, {}}}, {{'x'}, {}}, {{1, 2}, {3}}};
+	const auto b = encode(g);
+	CHECK(encode(tag) == Bytes({0x02, 'a', 'b', 0x03, 0x01, 0x00, 0x00, 0x00, 0xfe, 0xff, 0xff, 0xff, 0x03, 0x00, 0x00, 0x00}));
+	CHECK(roundTrip(g));
+
+	// More elements than the capacity are rejected before any is stored.
+	rpc::InlineMany<int32_t, 3> small;
+	CHECK(!decode(*encode(rpc::Many<int32_t>{1, 2, 3, 4}), small) && small.size() == 0);
+
+	const rpc::InlineMany<T::Name, 4> extra{{'y'}, {'z', 'w'}};
+	CHECK(W::LabelFunction(g, extra) == arguments(g, extra, rpc::Call<T::Tags>{}).size());
+	CHECK(W::LabelCallback(g.tags) == encode(g.tags)->size());
+
+	const A::Group a(b->data());
+	CHECK(a.tags().size() == 2 && a.tags()[0].values()[1] == -2 && a.tags()[1].name()[0] == 'c');
+	CHECK(a.aliases()[0][0] == 'x' && a.nested()[1][0] == 3 && a.length() == b->size());
+
+	Stream s;
+	auto aliases = B::Group<Stream>(s).tags(g.tags.size());
+
+	for(const auto& t: g.tags)
+	{
+		build(s, t);
+	}
+
+	auto nested = std::move(aliases).aliases(g.aliases.size());
+
+	for(const auto& n: g.aliases)
+	{
+		rpc::TypeInfo<T::Name>::write(s, n);
+	}
+
+	CHECK(finishes<B::Group<Stream, 3>>(std::move(nested).nested(g.nested.size())));
+
+	for(const auto& n: g.nested)
+	{
+		rpc::TypeInfo<rpc::InlineMany<uint16_t, 2>>::write(s, n);
+	}
+
+	CHECK(s.data == b);
+	return failures;
+}
@@ -0,0 +1,76 @@
+#include "builders.h"
+#include "Stream.h"
+
+#include <type_traits>
+
+using B = BuildersContract::Builders;
+using T = BuildersContract::Types;
+
+template<class Last, class Builder> constexpr bool finishes(Builder&&) {
+	return std::is_same_v<std::decay_t<Builder>, Last>;
+}
+
+/// Writes the packet field by field, the collections element by element.
+static inline void build(Stream& s, const T::Packet& p)
+{
+	auto kind = B::Packet<Stream>(s).origin();
+	B::Origin<Stream>(s).x(p.origin.x).valid(p.origin.valid);
+	auto chunks = std::move(kind).kind(p.kind).payload(p.payload.size());
+	s.write(p.payload.data(), p.payload.size());
+	auto routes = std::move(chunks).chunks(p.chunks.size());
+
+	for(const auto& c: p.chunks)
+	{
+		rpc::TypeInfo<rpc::Many<uint8_t>>::write(s, c);
+	}
+
+	auto last = std::move(routes).routes(p.routes.size());
+
+	for(const auto& r: p.routes)
+	{
+		B::Origin<Stream>(s).x(r.x).valid(r.valid);
+	}
+
+	CHECK(finishes<B::Packet<Stream, 5>>(std::move(last)));
+}
+
+int main()
+{
+	const T::Origin o{0x1234, true};
+	const T::Packet p{o, 9, {1, 2}, {{3}, {}}, {o, {5, false}}};
+
+	// Written field by field in wire order, the bytes are the same as those of the serializers.
+	Stream s;
+	CHECK(finishes<B::Origin<Stream, 2>>(B::Origin<Stream>(s).x(o.x).valid(o.valid)));
+	CHECK(s.data == encode(o));
+
+	Stream t;
+	build(t, p);
+	CHECK(t.data == encode(p));
+
+	Stream u;
+	auto more = B::SendFunction<Stream>(u).p();
+	build(u, p);
+	CHECK(finishes<B::SendFunction<Stream, 3>>(std::move(more).more(0).callback({7})));
+	CHECK(u.data == arguments(p, T::Packets{}, rpc::Call<bool>{7}));
+
+	Stream v;
+	CHECK(finishes<B::DropCall<Stream, 1>>(B::DropCall<Stream>(v).id(0x01020304)));
+	CHECK(v.data == Bytes({0x04, 0x03, 0x02, 0x01}));
+
+	Stream w;
+	auto exports = B::ChannelSession::ConnectCreate<Stream>(w).from();
+	B::Origin<Stream>(w).x(o.x).valid(o.valid);
+	CHECK(finishes<B::ChannelSession::ConnectCreate<Stream, 3>>(std::move(exports)._exports({{1}, {2}})._accept({3})));
+	CHECK(w.data == arguments(o, T::ChannelSession::ChannelCallbackExports{{1}, {2}}, rpc::Call<T::ChannelSession::ChannelCallExports>{3}));
+
+	// Fields named like the members of the builder are written through renamed setters.
+	Stream x;
+	auto nest = B::Names<Stream>(x)._put(1)._putFlag(true)._reserve(1);
+	x.write(p.payload.data(), 1);
+	auto count = std::move(nest)._nest();
+	B::Origin<Stream>(x).x(o.x).valid(o.valid);
+	CHECK(finishes<B::Names<Stream, 5>>(std::move(count)._fieldCount(0x0506)));
+	CHECK(x.data == encode(T::Names{1, true, {1}, o, 0x0506}));
+	return failures;
+}
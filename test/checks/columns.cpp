@@ -0,0 +1,39 @@
+#include "columns.h"
+#include "Stream.h"
+
+using T = ColumnsContract::Types;
+using C = ColumnsContract::Columns;
+
+// The columns go on the wire exactly like the collections of the aggregates.
+static_assert(rpc::TypeInfo<C::Reading<rpc::Many>>::sgn == rpc::TypeInfo<rpc::Many<T::Reading>>::sgn);
+static_assert(rpc::TypeInfo<C::Single<rpc::Many>>::sgn == rpc::TypeInfo<rpc::Many<T::Single>>::sgn);
+
+int main()
+{
+	const rpc::Many<T::Reading> rows{{1, true, {2, 3}, -4}, {5, false, {}, 6}};
+	const auto b = encode(rows);
+
+	// Decoded from the bytes of the aggregates into columns, then written back the same.
+	C::Reading<rpc::Many> r;
+	CHECK(b && decode(*b, r));
+	CHECK(r.size() == 2 && r.sensor[1] == 5 && r.valid[0] && r.unit[0].size() == 2 && r.value[0] == -4);
+	CHECK(encode(r) == b);
+
+	// A bogus count in a truncated message fails after the elements that are there, without sizing the columns for it.
+	const Bytes bogus{0xff, 0xff, 0xff, 0xff, 0x0f, 0x01, 0x00, 0x01, 0x00};
+	CHECK(!decode(bogus, r) && r.size() == 1 && r.sensor[0] == 1);
+
+	// Decoding an empty collection leaves no columns behind from before.
+	CHECK(decode(Bytes({0}), r) && r.size() == 0);
+
+	C::Single<rpc::Many> s;
+	s.resize(3);
+	s.only = {1, 0, 1};
+	CHECK(encode(s) == encode(rpc::Many<T::Single>{{true}, {false}, {true}}));
+	CHECK(roundTrip(s));
+
+	// Empty aggregates get no columns, their collections are just a count.
+	CHECK(encode(rpc::Many<T::Nothing>(2)) == Bytes({2}));
+	CHECK(roundTrip(rpc::Many<T::Nothing>(3)));
+	return failures;
+}
@@ -0,0 +1,38 @@
+#include "packed.h"
+#include "Stream.h"
+
+using T = PackedContract::Types;
+
+// The static assertions on the layout are in the serializers.
+static_assert(sizeof(T::Point) == 15);
+static_assert(sizeof(T::Segment) == 30);
+
+// An empty aggregate takes a byte in memory but none on the wire, so it is not packed, nor the ones around it.
+static_assert(sizeof(T::Tagged) == 16);
+
+/// The members one by one, as the aggregate would go on the wire if it was not packed.
+template<class S, class V> inline Bytes walked(const V& v)
+{
+	Stream s;
+	S::write(s, v);
+	return s.data;
+}
+
+int main()
+{
+	const T::Point p{-2, 0x1234, true, 0x0102030405060708};
+	const T::Segment s{p, {3, 4, false, 5}};
+
+	// Copied in one go, exactly like written member by member.
+	CHECK(encode(p) == Bytes({0xfe, 0xff, 0xff, 0xff, 0x34, 0x12, 0x01, 0x08, 0x07, 0x06, 0x05, 0x04, 0x03, 0x02, 0x01}));
+	CHECK(encode(s) == walked<rpc::StructTypeInfo<T::Segment, rpc::StructMember<&T::Segment::from>, rpc::StructMember<&T::Segment::to>>>(s));
+
+	CHECK(roundTrip(p));
+	CHECK(roundTrip(s));
+	CHECK(roundTrip(T::Label{{1, 2, 3}, p}));
+
+	// Written member by member, the empty one taking no bytes.
+	CHECK(encode(T::Tagged{{}, p}) == encode(p));
+	CHECK(roundTrip(T::Tagged{{}, p}));
+	return failures;
+}
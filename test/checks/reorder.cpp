@@ -0,0 +1,29 @@
+#include "reorder.h"
+#include "Stream.h"
+
+using T = ReorderContract::Types;
+
+// Declared widest first, so there is no padding between the members (there would be 16 bytes of it otherwise).
+static_assert(sizeof(T::Mixed) == 16);
+
+int main()
+{
+	T::Mixed m;
+	m.flag = true;
+	m.stamp = 0x0102030405060708;
+	m.code = 0x0a0b;
+	m.ok = false;
+	m.count = 0x11223344;
+
+	// Whatever order they are declared in, the members go on the wire in the order of the contract.
+	CHECK(encode(m) == Bytes({0x01, 0x08, 0x07, 0x06, 0x05, 0x04, 0x03, 0x02, 0x01, 0x0b, 0x0a, 0x00, 0x44, 0x33, 0x22, 0x11}));
+
+	T::Nested n;
+	n.small = 9;
+	n.mixed = m;
+	n.tail = {1, 2};
+	n.id = -1;
+	CHECK(encode(n) == arguments(uint8_t(9), m, rpc::Many<uint16_t>{1, 2}, int32_t(-1)));
+	CHECK(roundTrip(n));
+	return failures;
+}
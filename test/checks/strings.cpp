@@ -0,0 +1,61 @@
+#include "strings.h"
+#include "Stream.h"
+
+#include <type_traits>
+
+using T = StringsContract::Types;
+using V = StringsContract::Views;
+using W = StringsContract::WireSizes;
+using A = StringsContract::Accessors;
+using B = StringsContract::Builders;
+
+// Strings are owned or viewed along with the collections, and go on the wire alike.
+static_assert(std::is_same_v<T::Text, std::string>);
+static_assert(std::is_same_v<V::Text, std::string_view>);
+static_assert(std::is_same_v<decltype(V::Person::nicknames), rpc::View<std::string_view>>);
+static_assert(rpc::TypeInfo<T::Person>::sgn == rpc::TypeInfo<V::Person>::sgn);
+static_assert(rpc::TypeInfo<T::GreetFunction>::sgn == rpc::TypeInfo<V::GreetFunction>::sgn);
+
+// A string is of variable size on the wire, so nothing after one is at a known offset.
+static_assert(A::Person::fixedSize == rpc::variableSize);
+
+template<class Last, class Builder> constexpr bool finishes(Builder&&) {
+	return std::is_same_v<std::decay_t<Builder>, Last>;
+}
+
+int main()
+{
+	const T::Person p{"ann", {"a", ""}, {"x", "yz"}, 30};
+	const std::string_view nicknames[] = {"a", ""};
+	const V::Person v{"ann", {nicknames, 2}, {"x", "yz"}, 30};
+
+	// Length prefixed characters, the owned and the viewed ones alike.
+	const Bytes b{3, 'a', 'n', 'n', 2, 1, 'a', 0, 1, 'x', 2, 'y', 'z', 30};
+	CHECK(encode(p) == b);
+	CHECK(encode(v) == b);
+	CHECK(roundTrip(p));
+
+	CHECK(W::sizeOf(p) == b.size() && W::sizeOf(v) == b.size());
+	CHECK(W::GreetFunction(p, p.name) == b.size() + 4 + rpc::callWireSize);
+	CHECK(W::ChatSession::HeardCallback(p.name, v.name) == 8);
+
+	// The accessors point at the characters in the serialized bytes.
+	const A::Person a(b.data());
+	CHECK(a.name() == "ann" && a.nicknames().size() == 2 && a.nicknames()[0] == "a" && a.nicknames()[1].empty());
+	CHECK(a.initials()[1] == "yz" && a.age() == 30 && a.length() == b.size());
+
+	const auto h = arguments(std::string("bob"), std::string("hi"));
+	CHECK(A::ChatSession::HeardCallback(h.data()).from() == "bob" && A::ChatSession::HeardCallback(h.data()).line() == "hi");
+
+	Stream s;
+	auto nicks = B::Person<Stream>(s).name("ann").nicknames(2);
+	rpc::TypeInfo<std::string_view>::write(s, "a");
+	rpc::TypeInfo<std::string_view>::write(s, "");
+	CHECK(finishes<B::Person<Stream, 4>>(std::move(nicks).initials({"x", "yz"}).age(30)));
+	CHECK(s.data == b);
+
+	Stream j;
+	CHECK(finishes<B::ChatSession::JoinCreate<Stream, 3>>(B::ChatSession::JoinCreate<Stream>(j).nick("me")._exports({{1}, {2}})._accept({3})));
+	CHECK(j.data == arguments(std::string("me"), T::ChatSession::ChatCallbackExports{{1}, {2}}, rpc::Call<T::ChatSession::JoinAccept>{3}));
+	return failures;
+}
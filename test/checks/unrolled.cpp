@@ -0,0 +1,54 @@
+#include "unrolled.h"
+#include "Stream.h"
+
+using T = UnrolledContract::Types;
+
+/// The serializer the runtime templates would walk the members with.
+template<class U, auto... m> using Walked = rpc::StructTypeInfo<U, rpc::StructMember<m>...>;
+
+// The unrolled serializers must be interchangeable with the walked ones.
+template<class U, class W> constexpr bool sameAs = rpc::TypeInfo<U>::sgn == W::sgn && rpc::TypeInfo<U>::isFixedSize == W::isFixedSize;
+
+using Sample = Walked<T::Sample, &T::Sample::value, &T::Sample::valid>;
+using Series = Walked<T::Series, &T::Series::first, &T::Series::rest, &T::Series::name>;
+using Wrapped = Walked<T::Wrapped, &T::Wrapped::none, &T::Wrapped::count>;
+using Calls = Walked<T::StreamSession::StreamCallExports, &T::StreamSession::StreamCallExports::push, &T::StreamSession::StreamCallExports::_close>;
+using Callbacks = Walked<T::StreamSession::StreamCallbackExports, &T::StreamSession::StreamCallbackExports::pushed, &T::StreamSession::StreamCallbackExports::_close>;
+
+static_assert(sameAs<T::Sample, Sample>);
+static_assert(sameAs<T::Series, Series>);
+static_assert(sameAs<T::Nothing, Walked<T::Nothing>>);
+static_assert(sameAs<T::Wrapped, Wrapped>);
+static_assert(sameAs<T::StreamSession::StreamCallExports, Calls>);
+static_assert(sameAs<T::StreamSession::StreamCallbackExports, Callbacks>);
+
+static_assert(rpc::TypeInfo<T::Sample>::size({}) == 3);
+
+/// The bytes the walked serializer writes.
+template<class W, class V> inline Bytes walked(const V& v)
+{
+	Stream s;
+	W::write(s, v);
+	return s.data;
+}
+
+int main()
+{
+	const T::Series s{{-2, true}, {{3, false}, {4, true}}, {5, 6, 7}};
+	const T::StreamSession::StreamCallExports e{{1}, {2}};
+
+	CHECK(encode(s) == walked<Series>(s));
+	CHECK(encode(e) == walked<Calls>(e));
+	CHECK(encode(s.first) == Bytes({0xfe, 0xff, 0x01}));
+
+	// An empty aggregate takes no bytes, not even when nested.
+	const T::Wrapped w{{}, 0x0102};
+	CHECK(encode(T::Nothing{}) == Bytes{});
+	CHECK(encode(w) == Bytes({0x02, 0x01}) && encode(w) == walked<Wrapped>(w));
+	CHECK(roundTrip(w));
+
+	CHECK(roundTrip(s));
+	CHECK(roundTrip(e));
+	CHECK(roundTrip(T::StreamSession::StreamCallbackExports{{3}, {4}}));
+	return failures;
+}
@@ -0,0 +1,32 @@
+#include "varint.h"
+#include "Stream.h"
+
+#include <type_traits>
+
+using T = VarintContract::Types;
+using C = VarintContract::Columns;
+
+// Wide integers are varint encoded in the signatures, also through an alias.
+static_assert(std::is_same_v<T::LookupFunction, rpc::Call<rpc::Varint<uint32_t>, rpc::Many<uint32_t>, rpc::Many<T::Entry>, rpc::Call<rpc::Varint<int32_t>>>>);
+static_assert(std::is_same_v<T::CursorSession::OpenAccept, rpc::Call<rpc::Varint<uint32_t>, T::CursorSession::CursorCallExports>>);
+
+// As well as in the serializers, narrow ones and the elements of collections keep their width.
+static_assert(rpc::TypeInfo<T::Entry>::sgn == rpc::structSignature(rpc::TypeInfo<rpc::Varint<uint32_t>>::sgn, rpc::TypeInfo<uint8_t>::sgn, rpc::TypeInfo<rpc::Varint<int64_t>>::sgn, rpc::FlagsInfo<2>::sgn));
+static_assert(!rpc::TypeInfo<T::Entry>::isFixedSize);
+
+int main()
+{
+	const T::Entry e{300, 5, -1, true, false};
+	CHECK(encode(e) == Bytes({0xac, 0x02, 0x05, 0x01, 0x01}));
+	CHECK(roundTrip(e));
+	CHECK(roundTrip(T::Entry{0xffffffff, 0, INT64_MIN, false, true}));
+	CHECK(encode(T::Ids{300}) == Bytes({0x01, 0x2c, 0x01, 0x00, 0x00}));
+
+	// Varint members kept as plain integers in the columns, on the wire like in the aggregates.
+	const rpc::Many<T::Entry> rows{e, {1, 2, 64, false, true}};
+	C::Entry<rpc::Many> c;
+	CHECK(decode(*encode(rows), c));
+	CHECK(c.size() == 2 && c.id[0] == 300 && c.delta[0] == -1 && c.delta[1] == 64 && c.off[1]);
+	CHECK(encode(c) == encode(rows));
+	return failures;
+}
@@ -0,0 +1,222 @@
+#ifndef _ACCESSORS_H_
+#define _ACCESSORS_H_
+
+#include "base/Call.h"
+#include "base/Symbol.h"
+
+#include "types/Collection.h"
+#include "types/StructTypeInfo.h"
+#include "types/WireRecord.h"
+
+#include "framework/Session.h"
+
+struct AccessorsContract
+{
+    class Parametric;
+    class Types;
+    class Symbols;
+    class Accessors;
+};
+
+/* Readers of the wire format */
+struct AccessorsContract::Parametric
+{
+    template<template<class> class Collection> using Level = uint8_t;
+
+    template<template<class> class Collection> struct Point
+    {
+        int32_t x;
+        uint16_t y;
+        bool visible;
+        Level<Collection> level;
+    };
+
+    template<template<class> class Collection> struct Shape
+    {
+        Point<Collection> origin;
+        Collection<Point<Collection>> points;
+        bool closed;
+        int16_t tail;
+    };
+
+    template<template<class> class Collection> using DrawCallback = rpc::Call</* retval */ bool>;
+    template<template<class> class Collection> using DrawFunction = rpc::Call
+    <
+        /* s        */ Shape<Collection>,
+        /* at       */ Point<Collection>,
+        /* callback */ DrawCallback<Collection>
+    >;
+
+    template<template<class> class Collection> using ClearCall = rpc::Call<>;
+
+    struct ViewSession
+    {
+        template<template<class> class Collection> using MoveCall = rpc::Call</* to */ Point<Collection>>;
+        template<template<class> class Collection> using MovedCallback = rpc::Call</* ok */ bool>;
+
+        template<template<class> class Collection> struct ViewCallExports
+        {
+            MoveCall<Collection> move;
+            rpc::Call<> _close;
+        };
+
+        template<template<class> class Collection> struct ViewCallbackExports
+        {
+            MovedCallback<Collection> moved;
+            rpc::Call<> _close;
+        };
+
+        template<template<class> class Collection> using OpenAccept = rpc::Call
+        <
+            /* _retval  */ uint32_t,
+            /* _exports */ ViewCallExports<Collection>
+        >;
+        template<template<class> class Collection> using OpenCreate = rpc::Call
+        <
+            /* from     */ Point<Collection>,
+            /* _exports */ ViewCallbackExports<Collection>,
+            /* _accept  */ OpenAccept<Collection>
+        >;
+    };
+};
+
+namespace rpc
+{
+    template<template<class> class Collection> struct TypeInfo<AccessorsContract::Parametric::Point<Collection>>: StructTypeInfo<
+        AccessorsContract::Parametric::Point<Collection>,
+        StructMember<&AccessorsContract::Parametric::Point<Collection>::x>,
+        StructMember<&AccessorsContract::Parametric::Point<Collection>::y>,
+        StructMember<&AccessorsContract::Parametric::Point<Collection>::visible>,
+        StructMember<&AccessorsContract::Parametric::Point<Collection>::level>
+    > {};
+
+    template<template<class> class Collection> struct TypeInfo<AccessorsContract::Parametric::Shape<Collection>>: StructTypeInfo<
+        AccessorsContract::Parametric::Shape<Collection>,
+        StructMember<&AccessorsContract::Parametric::Shape<Collection>::origin>,
+        StructMember<&AccessorsContract::Parametric::Shape<Collection>::points>,
+        StructMember<&AccessorsContract::Parametric::Shape<Collection>::closed>,
+        StructMember<&AccessorsContract::Parametric::Shape<Collection>::tail>
+    > {};
+
+    template<template<class> class Collection> struct TypeInfo<AccessorsContract::Parametric::ViewSession::ViewCallExports<Collection>>: StructTypeInfo<
+        AccessorsContract::Parametric::ViewSession::ViewCallExports<Collection>,
+        StructMember<&AccessorsContract::Parametric::ViewSession::ViewCallExports<Collection>::move>,
+        StructMember<&AccessorsContract::Parametric::ViewSession::ViewCallExports<Collection>::_close>
+    > {};
+
+    template<template<class> class Collection> struct TypeInfo<AccessorsContract::Parametric::ViewSession::ViewCallbackExports<Collection>>: StructTypeInfo<
+        AccessorsContract::Parametric::ViewSession::ViewCallbackExports<Collection>,
+        StructMember<&AccessorsContract::Parametric::ViewSession::ViewCallbackExports<Collection>::moved>,
+        StructMember<&AccessorsContract::Parametric::ViewSession::ViewCallbackExports<Collection>::_close>
+    > {};
+}
+
+struct AccessorsContract::Types
+{
+    using Level = AccessorsContract::Parametric::Level<rpc::Many>;
+    using Point = AccessorsContract::Parametric::Point<rpc::Many>;
+    using Shape = AccessorsContract::Parametric::Shape<rpc::Many>;
+    using DrawFunction = AccessorsContract::Parametric::DrawFunction<rpc::Many>;
+    using ClearCall = AccessorsContract::Parametric::ClearCall<rpc::Many>;
+
+    struct ViewSession
+    {
+        using ViewCallExports = AccessorsContract::Parametric::ViewSession::ViewCallExports<rpc::Many>;
+        using ViewCallbackExports = AccessorsContract::Parametric::ViewSession::ViewCallbackExports<rpc::Many>;
+        using OpenAccept = AccessorsContract::Parametric::ViewSession::OpenAccept<rpc::Many>;
+        using OpenCreate = AccessorsContract::Parametric::ViewSession::OpenCreate<rpc::Many>;
+        using MoveCall = AccessorsContract::Parametric::ViewSession::MoveCall<rpc::Many>;
+        using MovedCallback = AccessorsContract::Parametric::ViewSession::MovedCallback<rpc::Many>;
+    };
+};
+
+struct AccessorsContract::Accessors
+{
+    using Level = uint8_t;
+
+    struct Point: rpc::WireRecord<int32_t, uint16_t, bool, Level>
+    {
+        using WireRecord::WireRecord;
+        inline auto x() const { return this->template field<0, 0>(); }
+        inline auto y() const { return this->template field<1, 4>(); }
+        inline auto visible() const { return this->template field<2, 6>(); }
+        inline auto level() const { return this->template field<3, 7>(); }
+        static constexpr size_t wireSize = 8;
+    };
+
+    struct Shape: rpc::WireRecord<Point, rpc::WireMany<Point>, bool, int16_t>
+    {
+        using WireRecord::WireRecord;
+        inline auto origin() const { return this->template field<0, 0>(); }
+        inline auto points() const { return this->template field<1, 8>(); }
+        inline auto closed() const { return this->template field<2>(); }
+        inline auto tail() const { return this->template field<3>(); }
+    };
+
+    struct DrawCallback: rpc::WireRecord<bool>
+    {
+        using WireRecord::WireRecord;
+        inline auto retval() const { return this->template field<0, 0>(); }
+        static constexpr size_t wireSize = 1;
+    };
+
+    struct DrawFunction: rpc::WireRecord<Shape, Point, rpc::WireCall>
+    {
+        using WireRecord::WireRecord;
+        inline auto s() const { return this->template field<0, 0>(); }
+        inline auto at() const { return this->template field<1>(); }
+        inline auto callback() const { return this->template field<2>(); }
+    };
+
+    struct ClearCall: rpc::WireRecord<>
+    {
+        using WireRecord::WireRecord;
+        static constexpr size_t wireSize = 0;
+    };
+
+    struct ViewSession
+    {
+        struct MoveCall: rpc::WireRecord<Point>
+        {
+            using WireRecord::WireRecord;
+            inline auto to() const { return this->template field<0, 0>(); }
+            static constexpr size_t wireSize = 8;
+        };
+
+        struct MovedCallback: rpc::WireRecord<bool>
+        {
+            using WireRecord::WireRecord;
+            inline auto ok() const { return this->template field<0, 0>(); }
+            static constexpr size_t wireSize = 1;
+        };
+
+        struct OpenAccept: rpc::WireRecord<uint32_t, rpc::WireCalls<2>>
+        {
+            using WireRecord::WireRecord;
+            inline auto _retval() const { return this->template field<0, 0>(); }
+            inline auto _exports() const { return this->template field<1, 4>(); }
+        };
+
+        struct OpenCreate: rpc::WireRecord<Point, rpc::WireCalls<2>, rpc::WireCall>
+        {
+            using WireRecord::WireRecord;
+            inline auto from() const { return this->template field<0, 0>(); }
+            inline auto _exports() const { return this->template field<1, 8>(); }
+            inline auto _accept() const { return this->template field<2>(); }
+        };
+    };
+};
+
+struct AccessorsContract::Symbols
+{
+    static constexpr inline auto symDraw = rpc::symbol(AccessorsContract::Types::DrawFunction(), "draw"_ctstr);
+    static constexpr inline auto symClear = rpc::symbol(AccessorsContract::Types::ClearCall(), "clear"_ctstr);
+
+    struct ViewSession
+    {
+        static constexpr inline auto symOpen = rpc::symbol(AccessorsContract::Types::ViewSession::OpenCreate(), "open"_ctstr);
+    };
+};
+
+
+#endif /* _ACCESSORS_H_ */
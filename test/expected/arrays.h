@@ -0,0 +1,181 @@
+#ifndef _ARRAYS_H_
+#define _ARRAYS_H_
+
+#include <cstddef>
+#include <type_traits>
+
+#include "base/Call.h"
+#include "base/Symbol.h"
+
+#include "types/Collection.h"
+#include "types/Array.h"
+#include "types/StructTypeInfo.h"
+#include "types/WireRecord.h"
+
+#include "framework/Session.h"
+
+struct ArraysContract
+{
+    class Parametric;
+    class Types;
+    class Symbols;
+    class WireSizes;
+    class Accessors;
+};
+
+/* Fixed length arrays */
+struct ArraysContract::Parametric
+{
+    template<template<class> class Collection> using Vector = std::array<int16_t, 3>;
+
+    template<template<class> class Collection> struct [[gnu::packed]] Pose
+    {
+        Vector<Collection> position;
+        std::array<std::array<int8_t, 2>, 2> rotation;
+    };
+
+    template<template<class> class Collection> struct Track
+    {
+        std::array<Pose<Collection>, 4> poses;
+        std::array<Collection<uint8_t>, 2> names;
+        uint32_t id;
+    };
+
+    template<template<class> class Collection> using FollowCallback = rpc::Call</* retval */ std::array<uint32_t, 2>>;
+    template<template<class> class Collection> using FollowFunction = rpc::Call
+    <
+        /* t        */ Track<Collection>,
+        /* via      */ std::array<Vector<Collection>, 2>,
+        /* callback */ FollowCallback<Collection>
+    >;
+};
+
+namespace rpc
+{
+    template<template<class> class Collection> struct TypeInfo<ArraysContract::Parametric::Pose<Collection>>: TrivialStructTypeInfo<
+        ArraysContract::Parametric::Pose<Collection>,
+        StructMember<&ArraysContract::Parametric::Pose<Collection>::position>,
+        StructMember<&ArraysContract::Parametric::Pose<Collection>::rotation>
+    > {
+        static_assert(sizeof(ArraysContract::Parametric::Pose<Collection>) == 10, "ArraysContract::Parametric::Pose must be 10 bytes long like on the wire");
+        static_assert(offsetof(ArraysContract::Parametric::Pose<Collection>, position) == 0, "ArraysContract::Parametric::Pose::position must be at offset 0 like on the wire");
+        static_assert(offsetof(ArraysContract::Parametric::Pose<Collection>, rotation) == 6, "ArraysContract::Parametric::Pose::rotation must be at offset 6 like on the wire");
+    };
+
+    template<template<class> class Collection> struct TypeInfo<ArraysContract::Parametric::Track<Collection>>: StructTypeInfo<
+        ArraysContract::Parametric::Track<Collection>,
+        StructMember<&ArraysContract::Parametric::Track<Collection>::poses>,
+        StructMember<&ArraysContract::Parametric::Track<Collection>::names>,
+        StructMember<&ArraysContract::Parametric::Track<Collection>::id>
+    > {};
+}
+
+struct ArraysContract::Types
+{
+    using Vector = ArraysContract::Parametric::Vector<rpc::Many>;
+    using Pose = ArraysContract::Parametric::Pose<rpc::Many>;
+    using Track = ArraysContract::Parametric::Track<rpc::Many>;
+    using FollowFunction = ArraysContract::Parametric::FollowFunction<rpc::Many>;
+};
+
+struct ArraysContract::WireSizes
+{
+    template<class T>
+    static constexpr std::enable_if_t<std::is_arithmetic_v<T>, size_t> sizeOf(const T&)
+    {
+        return sizeof(T);
+    }
+
+    template<class C>
+    static inline auto sizeOf(const C& c) -> decltype(c.size(), size_t{})
+    {
+        auto ret = rpc::collectionHeaderSize(c.size());
+
+        for(const auto& e: c)
+        {
+            ret += sizeOf(e);
+        }
+
+        return ret;
+    }
+
+    template<class T, size_t N>
+    static inline size_t sizeOf(const std::array<T, N>& a)
+    {
+        size_t ret = 0;
+
+        for(const auto& e: a)
+        {
+            ret += sizeOf(e);
+        }
+
+        return ret;
+    }
+
+    static constexpr size_t Vector = 6;
+    static constexpr size_t Pose = 10;
+
+    template<template<class> class Collection>
+    static constexpr size_t sizeOf(const ArraysContract::Parametric::Pose<Collection>& )
+    {
+        return Pose;
+    }
+
+    template<template<class> class Collection>
+    static inline size_t sizeOf(const ArraysContract::Parametric::Track<Collection>& v)
+    {
+        return 44 + sizeOf(v.names);
+    }
+
+    static constexpr size_t FollowCallback = 8;
+
+    template<class A0, class A1>
+    static inline size_t FollowFunction(const A0& t, const A1& via)
+    {
+        return 12 + rpc::callWireSize + sizeOf(t);
+    }
+};
+
+struct ArraysContract::Accessors
+{
+    using Vector = rpc::WireArray<int16_t, 3>;
+
+    struct Pose: rpc::WireRecord<Vector, rpc::WireArray<rpc::WireArray<int8_t, 2>, 2>>
+    {
+        using WireRecord::WireRecord;
+        inline auto position() const { return this->template field<0, 0>(); }
+        inline auto rotation() const { return this->template field<1, 6>(); }
+        static constexpr size_t wireSize = 10;
+    };
+
+    struct Track: rpc::WireRecord<rpc::WireArray<Pose, 4>, rpc::WireArray<rpc::WireMany<uint8_t>, 2>, uint32_t>
+    {
+        using WireRecord::WireRecord;
+        inline auto poses() const { return this->template field<0, 0>(); }
+        inline auto names() const { return this->template field<1, 40>(); }
+        inline auto id() const { return this->template field<2>(); }
+    };
+
+    struct FollowCallback: rpc::WireRecord<rpc::WireArray<uint32_t, 2>>
+    {
+        using WireRecord::WireRecord;
+        inline auto retval() const { return this->template field<0, 0>(); }
+        static constexpr size_t wireSize = 8;
+    };
+
+    struct FollowFunction: rpc::WireRecord<Track, rpc::WireArray<Vector, 2>, rpc::WireCall>
+    {
+        using WireRecord::WireRecord;
+        inline auto t() const { return this->template field<0, 0>(); }
+        inline auto via() const { return this->template field<1>(); }
+        inline auto callback() const { return this->template field<2>(); }
+    };
+};
+
+struct ArraysContract::Symbols
+{
+    static constexpr inline auto symFollow = rpc::symbol(ArraysContract::Types::FollowFunction(), "follow"_ctstr);
+};
+
+
+#endif /* _ARRAYS_H_ */
@@ -0,0 +1,604 @@
+#ifndef _BITFLAGS_H_
+#define _BITFLAGS_H_
+
+#include <vector>
+
+#include "base/Call.h"
+#include "base/Symbol.h"
+
+#include "types/Collection.h"
+#include "types/StructTypeInfo.h"
+#include "types/WireRecord.h"
+#include "types/WireBuilder.h"
+
+#include "framework/Session.h"
+
+struct BitflagsContract
+{
+    class Parametric;
+    class Types;
+    class Symbols;
+    class Columns;
+    class Accessors;
+    class Builders;
+};
+
+/* Flags packed into bits */
+struct BitflagsContract::Parametric
+{
+    template<template<class> class Collection> struct Status
+    {
+        bool ready;
+        bool busy;
+        uint16_t code;
+        bool lone;
+        Collection<uint8_t> tail;
+        bool a;
+        bool b;
+        bool c;
+        bool d;
+        bool e;
+        bool f;
+        bool g;
+        bool h;
+        bool i;
+    };
+
+    template<template<class> class Collection> struct Pair
+    {
+        bool on;
+        bool off;
+    };
+
+    template<template<class> class Collection> struct Names
+    {
+        uint8_t field;
+        bool flag;
+        bool other;
+        uint16_t wireSize;
+    };
+
+    template<template<class> class Collection> using UpdateCallback = rpc::Call</* retval */ bool>;
+    template<template<class> class Collection> using UpdateFunction = rpc::Call
+    <
+        /* s        */ Collection<Status<Collection>>,
+        /* p        */ Pair<Collection>,
+        /* callback */ UpdateCallback<Collection>
+    >;
+};
+
+namespace rpc
+{
+    template<template<class> class Collection> struct TypeInfo<BitflagsContract::Parametric::Status<Collection>>: StructTypeInfo<
+        BitflagsContract::Parametric::Status<Collection>,
+        StructFlags<&BitflagsContract::Parametric::Status<Collection>::ready, &BitflagsContract::Parametric::Status<Collection>::busy>,
+        StructMember<&BitflagsContract::Parametric::Status<Collection>::code>,
+        StructMember<&BitflagsContract::Parametric::Status<Collection>::lone>,
+        StructMember<&BitflagsContract::Parametric::Status<Collection>::tail>,
+        StructFlags<&BitflagsContract::Parametric::Status<Collection>::a, &BitflagsContract::Parametric::Status<Collection>::b, &BitflagsContract::Parametric::Status<Collection>::c, &BitflagsContract::Parametric::Status<Collection>::d, &BitflagsContract::Parametric::Status<Collection>::e, &BitflagsContract::Parametric::Status<Collection>::f, &BitflagsContract::Parametric::Status<Collection>::g, &BitflagsContract::Parametric::Status<Collection>::h, &BitflagsContract::Parametric::Status<Collection>::i>
+    > {};
+
+    template<template<class> class Collection> struct TypeInfo<BitflagsContract::Parametric::Pair<Collection>>: StructTypeInfo<
+        BitflagsContract::Parametric::Pair<Collection>,
+        StructFlags<&BitflagsContract::Parametric::Pair<Collection>::on, &BitflagsContract::Parametric::Pair<Collection>::off>
+    > {};
+
+    template<template<class> class Collection> struct TypeInfo<BitflagsContract::Parametric::Names<Collection>>: StructTypeInfo<
+        BitflagsContract::Parametric::Names<Collection>,
+        StructMember<&BitflagsContract::Parametric::Names<Collection>::field>,
+        StructFlags<&BitflagsContract::Parametric::Names<Collection>::flag, &BitflagsContract::Parametric::Names<Collection>::other>,
+        StructMember<&BitflagsContract::Parametric::Names<Collection>::wireSize>
+    > {};
+}
+
+struct BitflagsContract::Types
+{
+    using Status = BitflagsContract::Parametric::Status<rpc::Many>;
+    using Pair = BitflagsContract::Parametric::Pair<rpc::Many>;
+    using Names = BitflagsContract::Parametric::Names<rpc::Many>;
+    using UpdateFunction = BitflagsContract::Parametric::UpdateFunction<rpc::Many>;
+};
+
+struct BitflagsContract::Columns
+{
+    template<template<class> class Collection> struct Status
+    {
+        std::vector<uint8_t> ready;
+        std::vector<uint8_t> busy;
+        std::vector<uint16_t> code;
+        std::vector<uint8_t> lone;
+        std::vector<Collection<uint8_t>> tail;
+        std::vector<uint8_t> a;
+        std::vector<uint8_t> b;
+        std::vector<uint8_t> c;
+        std::vector<uint8_t> d;
+        std::vector<uint8_t> e;
+        std::vector<uint8_t> f;
+        std::vector<uint8_t> g;
+        std::vector<uint8_t> h;
+        std::vector<uint8_t> i;
+
+        inline size_t size() const { return ready.size(); }
+
+        inline void resize(size_t n)
+        {
+            ready.resize(n);
+            busy.resize(n);
+            code.resize(n);
+            lone.resize(n);
+            tail.resize(n);
+            a.resize(n);
+            b.resize(n);
+            c.resize(n);
+            d.resize(n);
+            e.resize(n);
+            f.resize(n);
+            g.resize(n);
+            h.resize(n);
+            i.resize(n);
+        }
+    };
+
+    template<template<class> class Collection> struct Pair
+    {
+        std::vector<uint8_t> on;
+        std::vector<uint8_t> off;
+
+        inline size_t size() const { return on.size(); }
+
+        inline void resize(size_t n)
+        {
+            on.resize(n);
+            off.resize(n);
+        }
+    };
+
+    template<template<class> class Collection> struct Names
+    {
+        std::vector<uint8_t> field;
+        std::vector<uint8_t> flag;
+        std::vector<uint8_t> other;
+        std::vector<uint16_t> wireSize;
+
+        inline size_t size() const { return field.size(); }
+
+        inline void resize(size_t n)
+        {
+            field.resize(n);
+            flag.resize(n);
+            other.resize(n);
+            wireSize.resize(n);
+        }
+    };
+};
+
+namespace rpc
+{
+    template<template<class> class Collection> struct TypeInfo<BitflagsContract::Columns::Status<Collection>>
+    {
+        static constexpr auto sgn = TypeInfo<Collection<BitflagsContract::Parametric::Status<Collection>>>::sgn;
+        static constexpr bool isFixedSize = false;
+
+        static inline size_t size(const BitflagsContract::Columns::Status<Collection>& v)
+        {
+            auto ret = collectionHeaderSize(v.size()) + v.size() * 6;
+
+            for(size_t i = 0; i < v.size(); i++)
+            {
+                ret += TypeInfo<Collection<uint8_t>>::size(v.tail[i]);
+            }
+
+            return ret;
+        }
+
+        template<class S>
+        static inline bool write(S& s, const BitflagsContract::Columns::Status<Collection>& v)
+        {
+            if(!writeCollectionHeader(s, v.size()))
+            {
+                return false;
+            }
+
+            for(size_t i = 0; i < v.size(); i++)
+            {
+                if(!(FlagsInfo<2>::write(s, v.ready[i], v.busy[i])
+                    && TypeInfo<uint16_t>::write(s, v.code[i])
+                    && TypeInfo<uint8_t>::write(s, v.lone[i])
+                    && TypeInfo<Collection<uint8_t>>::write(s, v.tail[i])
+                    && FlagsInfo<9>::write(s, v.a[i], v.b[i], v.c[i], v.d[i], v.e[i], v.f[i], v.g[i], v.h[i], v.i[i])))
+                {
+                    return false;
+                }
+            }
+
+            return true;
+        }
+
+        template<class S>
+        static inline bool read(S& s, BitflagsContract::Columns::Status<Collection>& v)
+        {
+            size_t n;
+
+            if(!readCollectionHeader(s, n))
+            {
+                return false;
+            }
+
+            v.resize(0);
+
+            for(size_t i = 0; i < n; i++)
+            {
+                v.resize(i + 1);
+
+                if(!(FlagsInfo<2>::read(s, v.ready[i], v.busy[i])
+                    && TypeInfo<uint16_t>::read(s, v.code[i])
+                    && TypeInfo<uint8_t>::read(s, v.lone[i])
+                    && TypeInfo<Collection<uint8_t>>::read(s, v.tail[i])
+                    && FlagsInfo<9>::read(s, v.a[i], v.b[i], v.c[i], v.d[i], v.e[i], v.f[i], v.g[i], v.h[i], v.i[i])))
+                {
+                    return false;
+                }
+            }
+
+            return true;
+        }
+    };
+
+    template<template<class> class Collection> struct TypeInfo<BitflagsContract::Columns::Pair<Collection>>
+    {
+        static constexpr auto sgn = TypeInfo<Collection<BitflagsContract::Parametric::Pair<Collection>>>::sgn;
+        static constexpr bool isFixedSize = false;
+
+        static inline size_t size(const BitflagsContract::Columns::Pair<Collection>& v)
+        {
+            auto ret = collectionHeaderSize(v.size()) + v.size() * 1;
+
+            return ret;
+        }
+
+        template<class S>
+        static inline bool write(S& s, const BitflagsContract::Columns::Pair<Collection>& v)
+        {
+            if(!writeCollectionHeader(s, v.size()))
+            {
+                return false;
+            }
+
+            for(size_t i = 0; i < v.size(); i++)
+            {
+                if(!(FlagsInfo<2>::write(s, v.on[i], v.off[i])))
+                {
+                    return false;
+                }
+            }
+
+            return true;
+        }
+
+        template<class S>
+        static inline bool read(S& s, BitflagsContract::Columns::Pair<Collection>& v)
+        {
+            size_t n;
+
+            if(!readCollectionHeader(s, n))
+            {
+                return false;
+            }
+
+            v.resize(0);
+
+            for(size_t i = 0; i < n; i++)
+            {
+                v.resize(i + 1);
+
+                if(!(FlagsInfo<2>::read(s, v.on[i], v.off[i])))
+                {
+                    return false;
+                }
+            }
+
+            return true;
+        }
+    };
+
+    template<template<class> class Collection> struct TypeInfo<BitflagsContract::Columns::Names<Collection>>
+    {
+        static constexpr auto sgn = TypeInfo<Collection<BitflagsContract::Parametric::Names<Collection>>>::sgn;
+        static constexpr bool isFixedSize = false;
+
+        static inline size_t size(const BitflagsContract::Columns::Names<Collection>& v)
+        {
+            auto ret = collectionHeaderSize(v.size()) + v.size() * 4;
+
+            return ret;
+        }
+
+        template<class S>
+        static inline bool write(S& s, const BitflagsContract::Columns::Names<Collection>& v)
+        {
+            if(!writeCollectionHeader(s, v.size()))
+            {
+                return false;
+            }
+
+            for(size_t i = 0; i < v.size(); i++)
+            {
+                if(!(TypeInfo<uint8_t>::write(s, v.field[i])
+                    && FlagsInfo<2>::write(s, v.flag[i], v.other[i])
+                    && TypeInfo<uint16_t>::write(s, v.wireSize[i])))
+                {
+                    return false;
+                }
+            }
+
+            return true;
+        }
+
+        template<class S>
+        static inline bool read(S& s, BitflagsContract::Columns::Names<Collection>& v)
+        {
+            size_t n;
+
+            if(!readCollectionHeader(s, n))
+            {
+                return false;
+            }
+
+            v.resize(0);
+
+            for(size_t i = 0; i < n; i++)
+            {
+                v.resize(i + 1);
+
+                if(!(TypeInfo<uint8_t>::read(s, v.field[i])
+                    && FlagsInfo<2>::read(s, v.flag[i], v.other[i])
+                    && TypeInfo<uint16_t>::read(s, v.wireSize[i])))
+                {
+                    return false;
+                }
+            }
+
+            return true;
+        }
+    };
+}
+
+struct BitflagsContract::Accessors
+{
+    struct Status: rpc::WireRecord<rpc::WireFlags<2>, uint16_t, bool, rpc::WireMany<uint8_t>, rpc::WireFlags<9>>
+    {
+        using WireRecord::WireRecord;
+        inline bool ready() const { return this->template flag<0, 0, 0>(); }
+        inline bool busy() const { return this->template flag<0, 1, 0>(); }
+        inline auto code() const { return this->template field<1, 1>(); }
+        inline auto lone() const { return this->template field<2, 3>(); }
+        inline auto tail() const { return this->template field<3, 4>(); }
+        inline bool a() const { return this->template flag<4, 0>(); }
+        inline bool b() const { return this->template flag<4, 1>(); }
+        inline bool c() const { return this->template flag<4, 2>(); }
+        inline bool d() const { return this->template flag<4, 3>(); }
+        inline bool e() const { return this->template flag<4, 4>(); }
+        inline bool f() const { return this->template flag<4, 5>(); }
+        inline bool g() const { return this->template flag<4, 6>(); }
+        inline bool h() const { return this->template flag<4, 7>(); }
+        inline bool i() const { return this->template flag<4, 8>(); }
+    };
+
+    struct Pair: rpc::WireRecord<rpc::WireFlags<2>>
+    {
+        using WireRecord::WireRecord;
+        inline bool on() const { return this->template flag<0, 0, 0>(); }
+        inline bool off() const { return this->template flag<0, 1, 0>(); }
+        static constexpr size_t wireSize = 1;
+    };
+
+    struct Names: rpc::WireRecord<uint8_t, rpc::WireFlags<2>, uint16_t>
+    {
+        using WireRecord::WireRecord;
+        inline auto _field() const { return this->template field<0, 0>(); }
+        inline bool _flag() const { return this->template flag<1, 0, 1>(); }
+        inline bool other() const { return this->template flag<1, 1, 1>(); }
+        inline auto _wireSize() const { return this->template field<2, 2>(); }
+        static constexpr size_t wireSize = 4;
+    };
+
+    struct UpdateCallback: rpc::WireRecord<bool>
+    {
+        using WireRecord::WireRecord;
+        inline auto retval() const { return this->template field<0, 0>(); }
+        static constexpr size_t wireSize = 1;
+    };
+
+    struct UpdateFunction: rpc::WireRecord<rpc::WireMany<Status>, Pair, rpc::WireCall>
+    {
+        using WireRecord::WireRecord;
+        inline auto s() const { return this->template field<0, 0>(); }
+        inline auto p() const { return this->template field<1>(); }
+        inline auto callback() const { return this->template field<2>(); }
+    };
+};
+
+struct BitflagsContract::Builders
+{
+    template<class Out, size_t I = 0> struct Status: rpc::WireBuilder<Out>
+    {
+        using Status::WireBuilder::WireBuilder;
+        static constexpr size_t fieldCount = 14;
+
+        inline auto ready(bool v) &&
+        {
+            static_assert(I == 0, "Fields of Status must be written in wire order");
+            return this->template putFlag<Status<Out, 1>, 0, 2>(v);
+        }
+
+        inline auto busy(bool v) &&
+        {
+            static_assert(I == 1, "Fields of Status must be written in wire order");
+            return this->template putFlag<Status<Out, 2>, 1, 2>(v);
+        }
+
+        inline auto code(uint16_t v) &&
+        {
+            static_assert(I == 2, "Fields of Status must be written in wire order");
+            return this->template put<Status<Out, 3>>(v);
+        }
+
+        inline auto lone(bool v) &&
+        {
+            static_assert(I == 3, "Fields of Status must be written in wire order");
+            return this->template put<Status<Out, 4>>(v);
+        }
+
+        inline auto tail(size_t n) &&
+        {
+            static_assert(I == 4, "Fields of Status must be written in wire order");
+            return this->template reserve<Status<Out, 5>, uint8_t>(n);
+        }
+
+        inline auto a(bool v) &&
+        {
+            static_assert(I == 5, "Fields of Status must be written in wire order");
+            return this->template putFlag<Status<Out, 6>, 0, 9>(v);
+        }
+
+        inline auto b(bool v) &&
+        {
+            static_assert(I == 6, "Fields of Status must be written in wire order");
+            return this->template putFlag<Status<Out, 7>, 1, 9>(v);
+        }
+
+        inline auto c(bool v) &&
+        {
+            static_assert(I == 7, "Fields of Status must be written in wire order");
+            return this->template putFlag<Status<Out, 8>, 2, 9>(v);
+        }
+
+        inline auto d(bool v) &&
+        {
+            static_assert(I == 8, "Fields of Status must be written in wire order");
+            return this->template putFlag<Status<Out, 9>, 3, 9>(v);
+        }
+
+        inline auto e(bool v) &&
+        {
+            static_assert(I == 9, "Fields of Status must be written in wire order");
+            return this->template putFlag<Status<Out, 10>, 4, 9>(v);
+        }
+
+        inline auto f(bool v) &&
+        {
+            static_assert(I == 10, "Fields of Status must be written in wire order");
+            return this->template putFlag<Status<Out, 11>, 5, 9>(v);
+        }
+
+        inline auto g(bool v) &&
+        {
+            static_assert(I == 11, "Fields of Status must be written in wire order");
+            return this->template putFlag<Status<Out, 12>, 6, 9>(v);
+        }
+
+        inline auto h(bool v) &&
+        {
+            static_assert(I == 12, "Fields of Status must be written in wire order");
+            return this->template putFlag<Status<Out, 13>, 7, 9>(v);
+        }
+
+        inline auto i(bool v) &&
+        {
+            static_assert(I == 13, "Fields of Status must be written in wire order");
+            return this->template putFlag<Status<Out, 14>, 8, 9>(v);
+        }
+    };
+
+    template<class Out, size_t I = 0> struct Pair: rpc::WireBuilder<Out>
+    {
+        using Pair::WireBuilder::WireBuilder;
+        static constexpr size_t fieldCount = 2;
+
+        inline auto on(bool v) &&
+        {
+            static_assert(I == 0, "Fields of Pair must be written in wire order");
+            return this->template putFlag<Pair<Out, 1>, 0, 2>(v);
+        }
+
+        inline auto off(bool v) &&
+        {
+            static_assert(I == 1, "Fields of Pair must be written in wire order");
+            return this->template putFlag<Pair<Out, 2>, 1, 2>(v);
+        }
+    };
+
+    template<class Out, size_t I = 0> struct Names: rpc::WireBuilder<Out>
+    {
+        using Names::WireBuilder::WireBuilder;
+        static constexpr size_t fieldCount = 4;
+
+        inline auto field(uint8_t v) &&
+        {
+            static_assert(I == 0, "Fields of Names must be written in wire order");
+            return this->template put<Names<Out, 1>>(v);
+        }
+
+        inline auto flag(bool v) &&
+        {
+            static_assert(I == 1, "Fields of Names must be written in wire order");
+            return this->template putFlag<Names<Out, 2>, 0, 2>(v);
+        }
+
+        inline auto other(bool v) &&
+        {
+            static_assert(I == 2, "Fields of Names must be written in wire order");
+            return this->template putFlag<Names<Out, 3>, 1, 2>(v);
+        }
+
+        inline auto wireSize(uint16_t v) &&
+        {
+            static_assert(I == 3, "Fields of Names must be written in wire order");
+            return this->template put<Names<Out, 4>>(v);
+        }
+    };
+
+    template<class Out, size_t I = 0> struct UpdateCallback: rpc::WireBuilder<Out>
+    {
+        using UpdateCallback::WireBuilder::WireBuilder;
+        static constexpr size_t fieldCount = 1;
+
+        inline auto retval(bool v) &&
+        {
+            static_assert(I == 0, "Fields of UpdateCallback must be written in wire order");
+            return this->template put<UpdateCallback<Out, 1>>(v);
+        }
+    };
+
+    template<class Out, size_t I = 0> struct UpdateFunction: rpc::WireBuilder<Out>
+    {
+        using UpdateFunction::WireBuilder::WireBuilder;
+        static constexpr size_t fieldCount = 3;
+
+        inline auto s(size_t n) &&
+        {
+            static_assert(I == 0, "Fields of UpdateFunction must be written in wire order");
+            return this->template reserve<UpdateFunction<Out, 1>, Status<Out>>(n);
+        }
+
+        inline auto p() &&
+        {
+            static_assert(I == 1, "Fields of UpdateFunction must be written in wire order");
+            return this->template nest<UpdateFunction<Out, 2>, Pair<Out>>();
+        }
+
+        inline auto callback(const BitflagsContract::Parametric::UpdateCallback<rpc::Many>& v) &&
+        {
+            static_assert(I == 2, "Fields of UpdateFunction must be written in wire order");
+            return this->template put<UpdateFunction<Out, 3>>(v);
+        }
+    };
+};
+
+struct BitflagsContract::Symbols
+{
+    static constexpr inline auto symUpdate = rpc::symbol(BitflagsContract::Types::UpdateFunction(), "update"_ctstr);
+};
+
+
+#endif /* _BITFLAGS_H_ */
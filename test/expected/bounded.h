@@ -0,0 +1,250 @@
+#ifndef _BOUNDED_H_
+#define _BOUNDED_H_
+
+#include <type_traits>
+
+#include "base/Call.h"
+#include "base/Symbol.h"
+
+#include "types/Collection.h"
+#include "types/InlineMany.h"
+#include "types/StructTypeInfo.h"
+#include "types/WireRecord.h"
+#include "types/WireBuilder.h"
+
+#include "framework/Session.h"
+
+struct BoundedContract
+{
+    class Parametric;
+    class Types;
+    class Symbols;
+    class WireSizes;
+    class Accessors;
+    class Builders;
+};
+
+/* Bounded collections */
+struct BoundedContract::Parametric
+{
+    template<template<class> class Collection> using Name = rpc::InlineMany<uint8_t, 16>;
+
+    template<template<class> class Collection> struct Tag
+    {
+        Name<Collection> name;
+        rpc::InlineMany<int32_t, 3> values;
+    };
+
+    template<template<class> class Collection> using Tags = rpc::InlineMany<Tag<Collection>, 8>;
+
+    template<template<class> class Collection> struct Group
+    {
+        Tags<Collection> tags;
+        Collection<Name<Collection>> aliases;
+        rpc::InlineMany<rpc::InlineMany<uint16_t, 2>, 2> nested;
+    };
+
+    template<template<class> class Collection> using LabelCallback = rpc::Call</* retval */ Tags<Collection>>;
+    template<template<class> class Collection> using LabelFunction = rpc::Call
+    <
+        /* g        */ Group<Collection>,
+        /* extra    */ rpc::InlineMany<Name<Collection>, 4>,
+        /* callback */ LabelCallback<Collection>
+    >;
+};
+
+namespace rpc
+{
+    template<template<class> class Collection> struct TypeInfo<BoundedContract::Parametric::Tag<Collection>>: StructTypeInfo<
+        BoundedContract::Parametric::Tag<Collection>,
+        StructMember<&BoundedContract::Parametric::Tag<Collection>::name>,
+        StructMember<&BoundedContract::Parametric::Tag<Collection>::values>
+    > {};
+
+    template<template<class> class Collection> struct TypeInfo<BoundedContract::Parametric::Group<Collection>>: StructTypeInfo<
+        BoundedContract::Parametric::Group<Collection>,
+        StructMember<&BoundedContract::Parametric::Group<Collection>::tags>,
+        StructMember<&BoundedContract::Parametric::Group<Collection>::aliases>,
+        StructMember<&BoundedContract::Parametric::Group<Collection>::nested>
+    > {};
+}
+
+struct BoundedContract::Types
+{
+    using Name = BoundedContract::Parametric::Name<rpc::Many>;
+    using Tag = BoundedContract::Parametric::Tag<rpc::Many>;
+    using Tags = BoundedContract::Parametric::Tags<rpc::Many>;
+    using Group = BoundedContract::Parametric::Group<rpc::Many>;
+    using LabelFunction = BoundedContract::Parametric::LabelFunction<rpc::Many>;
+};
+
+struct BoundedContract::WireSizes
+{
+    template<class T>
+    static constexpr std::enable_if_t<std::is_arithmetic_v<T>, size_t> sizeOf(const T&)
+    {
+        return sizeof(T);
+    }
+
+    template<class C>
+    static inline auto sizeOf(const C& c) -> decltype(c.size(), size_t{})
+    {
+        auto ret = rpc::collectionHeaderSize(c.size());
+
+        for(const auto& e: c)
+        {
+            ret += sizeOf(e);
+        }
+
+        return ret;
+    }
+
+    template<template<class> class Collection>
+    static inline size_t sizeOf(const BoundedContract::Parametric::Tag<Collection>& v)
+    {
+        return rpc::collectionHeaderSize(v.name.size()) + v.name.size() * 1 + rpc::collectionHeaderSize(v.values.size()) + v.values.size() * 4;
+    }
+
+    template<template<class> class Collection>
+    static inline size_t sizeOf(const BoundedContract::Parametric::Group<Collection>& v)
+    {
+        return sizeOf(v.tags) + sizeOf(v.aliases) + sizeOf(v.nested);
+    }
+
+    template<class A0>
+    static inline size_t LabelCallback(const A0& retval)
+    {
+        return sizeOf(retval);
+    }
+
+    template<class A0, class A1>
+    static inline size_t LabelFunction(const A0& g, const A1& extra)
+    {
+        return rpc::callWireSize + sizeOf(g) + sizeOf(extra);
+    }
+};
+
+struct BoundedContract::Accessors
+{
+    using Name = rpc::WireMany<uint8_t, 16>;
+
+    struct Tag: rpc::WireRecord<Name, rpc::WireMany<int32_t, 3>>
+    {
+        using WireRecord::WireRecord;
+        inline auto name() const { return this->template field<0, 0>(); }
+        inline auto values() const { return this->template field<1>(); }
+    };
+
+    using Tags = rpc::WireMany<Tag, 8>;
+
+    struct Group: rpc::WireRecord<Tags, rpc::WireMany<Name>, rpc::WireMany<rpc::WireMany<uint16_t, 2>, 2>>
+    {
+        using WireRecord::WireRecord;
+        inline auto tags() const { return this->template field<0, 0>(); }
+        inline auto aliases() const { return this->template field<1>(); }
+        inline auto nested() const { return this->template field<2>(); }
+    };
+
+    struct LabelCallback: rpc::WireRecord<Tags>
+    {
+        using WireRecord::WireRecord;
+        inline auto retval() const { return this->template field<0, 0>(); }
+    };
+
+    struct LabelFunction: rpc::WireRecord<Group, rpc::WireMany<Name, 4>, rpc::WireCall>
+    {
+        using WireRecord::WireRecord;
+        inline auto g() const { return this->template field<0, 0>(); }
+        inline auto extra() const { return this->template field<1>(); }
+        inline auto callback() const { return this->template field<2>(); }
+    };
+};
+
+struct BoundedContract::Builders
+{
+    template<class Out, size_t I = 0> struct Tag: rpc::WireBuilder<Out>
+    {
+        using Tag::WireBuilder::WireBuilder;
+        static constexpr size_t fieldCount = 2;
+
+        inline auto name(size_t n) &&
+        {
+            static_assert(I == 0, "Fields of Tag must be written in wire order");
+            return this->template reserve<Tag<Out, 1>, uint8_t, 16>(n);
+        }
+
+        inline auto values(size_t n) &&
+        {
+            static_assert(I == 1, "Fields of Tag must be written in wire order");
+            return this->template reserve<Tag<Out, 2>, int32_t, 3>(n);
+        }
+    };
+
+    template<class Out, size_t I = 0> struct Group: rpc::WireBuilder<Out>
+    {
+        using Group::WireBuilder::WireBuilder;
+        static constexpr size_t fieldCount = 3;
+
+        inline auto tags(size_t n) &&
+        {
+            static_assert(I == 0, "Fields of Group must be written in wire order");
+            return this->template reserve<Group<Out, 1>, Tag<Out>, 8>(n);
+        }
+
+        inline auto aliases(size_t n) &&
+        {
+            static_assert(I == 1, "Fields of Group must be written in wire order");
+            return this->template reserve<Group<Out, 2>, rpc::WireMany<uint8_t, 16>>(n);
+        }
+
+        inline auto nested(size_t n) &&
+        {
+            static_assert(I == 2, "Fields of Group must be written in wire order");
+            return this->template reserve<Group<Out, 3>, rpc::WireMany<uint16_t, 2>, 2>(n);
+        }
+    };
+
+    template<class Out, size_t I = 0> struct LabelCallback: rpc::WireBuilder<Out>
+    {
+        using LabelCallback::WireBuilder::WireBuilder;
+        static constexpr size_t fieldCount = 1;
+
+        inline auto retval(size_t n) &&
+        {
+            static_assert(I == 0, "Fields of LabelCallback must be written in wire order");
+            return this->template reserve<LabelCallback<Out, 1>, Tag<Out>, 8>(n);
+        }
+    };
+
+    template<class Out, size_t I = 0> struct LabelFunction: rpc::WireBuilder<Out>
+    {
+        using LabelFunction::WireBuilder::WireBuilder;
+        static constexpr size_t fieldCount = 3;
+
+        inline auto g() &&
+        {
+            static_assert(I == 0, "Fields of LabelFunction must be written in wire order");
+            return this->template nest<LabelFunction<Out, 1>, Group<Out>>();
+        }
+
+        inline auto extra(size_t n) &&
+        {
+            static_assert(I == 1, "Fields of LabelFunction must be written in wire order");
+            return this->template reserve<LabelFunction<Out, 2>, rpc::WireMany<uint8_t, 16>, 4>(n);
+        }
+
+        inline auto callback(const BoundedContract::Parametric::LabelCallback<rpc::Many>& v) &&
+        {
+            static_assert(I == 2, "Fields of LabelFunction must be written in wire order");
+            return this->template put<LabelFunction<Out, 3>>(v);
+        }
+    };
+};
+
+struct BoundedContract::Symbols
+{
+    static constexpr inline auto symLabel = rpc::symbol(BoundedContract::Types::LabelFunction(), "label"_ctstr);
+};
+
+
+#endif /* _BOUNDED_H_ */
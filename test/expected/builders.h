@@ -0,0 +1,362 @@
+#ifndef _BUILDERS_H_
+#define _BUILDERS_H_
+
+#include "base/Call.h"
+#include "base/Symbol.h"
+
+#include "types/Collection.h"
+#include "types/StructTypeInfo.h"
+#include "types/WireBuilder.h"
+
+#include "framework/Session.h"
+
+struct BuildersContract
+{
+    class Parametric;
+    class Types;
+    class Symbols;
+    class Builders;
+};
+
+/* Writers of the wire format */
+struct BuildersContract::Parametric
+{
+    template<template<class> class Collection> struct Origin
+    {
+        uint16_t x;
+        bool valid;
+    };
+
+    template<template<class> class Collection> struct Packet
+    {
+        Origin<Collection> origin;
+        uint8_t kind;
+        Collection<uint8_t> payload;
+        Collection<Collection<uint8_t>> chunks;
+        Collection<Origin<Collection>> routes;
+    };
+
+    template<template<class> class Collection> using Packets = Collection<Packet<Collection>>;
+
+    template<template<class> class Collection> struct Names
+    {
+        uint8_t put;
+        bool putFlag;
+        Collection<uint8_t> reserve;
+        Origin<Collection> nest;
+        uint16_t fieldCount;
+    };
+
+    template<template<class> class Collection> using SendCallback = rpc::Call</* retval */ bool>;
+    template<template<class> class Collection> using SendFunction = rpc::Call
+    <
+        /* p        */ Packet<Collection>,
+        /* more     */ Packets<Collection>,
+        /* callback */ SendCallback<Collection>
+    >;
+
+    template<template<class> class Collection> using DropCall = rpc::Call</* id */ uint32_t>;
+
+    struct ChannelSession
+    {
+        template<template<class> class Collection> using PostCall = rpc::Call</* p */ Packet<Collection>>;
+        template<template<class> class Collection> using ReceivedCallback = rpc::Call</* count */ uint32_t>;
+
+        template<template<class> class Collection> struct ChannelCallExports
+        {
+            PostCall<Collection> post;
+            rpc::Call<> _close;
+        };
+
+        template<template<class> class Collection> struct ChannelCallbackExports
+        {
+            ReceivedCallback<Collection> received;
+            rpc::Call<> _close;
+        };
+
+        template<template<class> class Collection> using ConnectAccept = rpc::Call</* _exports */ ChannelCallExports<Collection>>;
+        template<template<class> class Collection> using ConnectCreate = rpc::Call
+        <
+            /* from     */ Origin<Collection>,
+            /* _exports */ ChannelCallbackExports<Collection>,
+            /* _accept  */ ConnectAccept<Collection>
+        >;
+    };
+};
+
+namespace rpc
+{
+    template<template<class> class Collection> struct TypeInfo<BuildersContract::Parametric::Origin<Collection>>: StructTypeInfo<
+        BuildersContract::Parametric::Origin<Collection>,
+        StructMember<&BuildersContract::Parametric::Origin<Collection>::x>,
+        StructMember<&BuildersContract::Parametric::Origin<Collection>::valid>
+    > {};
+
+    template<template<class> class Collection> struct TypeInfo<BuildersContract::Parametric::Packet<Collection>>: StructTypeInfo<
+        BuildersContract::Parametric::Packet<Collection>,
+        StructMember<&BuildersContract::Parametric::Packet<Collection>::origin>,
+        StructMember<&BuildersContract::Parametric::Packet<Collection>::kind>,
+        StructMember<&BuildersContract::Parametric::Packet<Collection>::payload>,
+        StructMember<&BuildersContract::Parametric::Packet<Collection>::chunks>,
+        StructMember<&BuildersContract::Parametric::Packet<Collection>::routes>
+    > {};
+
+    template<template<class> class Collection> struct TypeInfo<BuildersContract::Parametric::Names<Collection>>: StructTypeInfo<
+        BuildersContract::Parametric::Names<Collection>,
+        StructMember<&BuildersContract::Parametric::Names<Collection>::put>,
+        StructMember<&BuildersContract::Parametric::Names<Collection>::putFlag>,
+        StructMember<&BuildersContract::Parametric::Names<Collection>::reserve>,
+        StructMember<&BuildersContract::Parametric::Names<Collection>::nest>,
+        StructMember<&BuildersContract::Parametric::Names<Collection>::fieldCount>
+    > {};
+
+    template<template<class> class Collection> struct TypeInfo<BuildersContract::Parametric::ChannelSession::ChannelCallExports<Collection>>: StructTypeInfo<
+        BuildersContract::Parametric::ChannelSession::ChannelCallExports<Collection>,
+        StructMember<&BuildersContract::Parametric::ChannelSession::ChannelCallExports<Collection>::post>,
+        StructMember<&BuildersContract::Parametric::ChannelSession::ChannelCallExports<Collection>::_close>
+    > {};
+
+    template<template<class> class Collection> struct TypeInfo<BuildersContract::Parametric::ChannelSession::ChannelCallbackExports<Collection>>: StructTypeInfo<
+        BuildersContract::Parametric::ChannelSession::ChannelCallbackExports<Collection>,
+        StructMember<&BuildersContract::Parametric::ChannelSession::ChannelCallbackExports<Collection>::received>,
+        StructMember<&BuildersContract::Parametric::ChannelSession::ChannelCallbackExports<Collection>::_close>
+    > {};
+}
+
+struct BuildersContract::Types
+{
+    using Origin = BuildersContract::Parametric::Origin<rpc::Many>;
+    using Packet = BuildersContract::Parametric::Packet<rpc::Many>;
+    using Packets = BuildersContract::Parametric::Packets<rpc::Many>;
+    using Names = BuildersContract::Parametric::Names<rpc::Many>;
+    using SendFunction = BuildersContract::Parametric::SendFunction<rpc::Many>;
+    using DropCall = BuildersContract::Parametric::DropCall<rpc::Many>;
+
+    struct ChannelSession
+    {
+        using ChannelCallExports = BuildersContract::Parametric::ChannelSession::ChannelCallExports<rpc::Many>;
+        using ChannelCallbackExports = BuildersContract::Parametric::ChannelSession::ChannelCallbackExports<rpc::Many>;
+        using ConnectAccept = BuildersContract::Parametric::ChannelSession::ConnectAccept<rpc::Many>;
+        using ConnectCreate = BuildersContract::Parametric::ChannelSession::ConnectCreate<rpc::Many>;
+        using PostCall = BuildersContract::Parametric::ChannelSession::PostCall<rpc::Many>;
+        using ReceivedCallback = BuildersContract::Parametric::ChannelSession::ReceivedCallback<rpc::Many>;
+    };
+};
+
+struct BuildersContract::Builders
+{
+    template<class Out, size_t I = 0> struct Origin: rpc::WireBuilder<Out>
+    {
+        using Origin::WireBuilder::WireBuilder;
+        static constexpr size_t fieldCount = 2;
+
+        inline auto x(uint16_t v) &&
+        {
+            static_assert(I == 0, "Fields of Origin must be written in wire order");
+            return this->template put<Origin<Out, 1>>(v);
+        }
+
+        inline auto valid(bool v) &&
+        {
+            static_assert(I == 1, "Fields of Origin must be written in wire order");
+            return this->template put<Origin<Out, 2>>(v);
+        }
+    };
+
+    template<class Out, size_t I = 0> struct Packet: rpc::WireBuilder<Out>
+    {
+        using Packet::WireBuilder::WireBuilder;
+        static constexpr size_t fieldCount = 5;
+
+        inline auto origin() &&
+        {
+            static_assert(I == 0, "Fields of Packet must be written in wire order");
+            return this->template nest<Packet<Out, 1>, Origin<Out>>();
+        }
+
+        inline auto kind(uint8_t v) &&
+        {
+            static_assert(I == 1, "Fields of Packet must be written in wire order");
+            return this->template put<Packet<Out, 2>>(v);
+        }
+
+        inline auto payload(size_t n) &&
+        {
+            static_assert(I == 2, "Fields of Packet must be written in wire order");
+            return this->template reserve<Packet<Out, 3>, uint8_t>(n);
+        }
+
+        inline auto chunks(size_t n) &&
+        {
+            static_assert(I == 3, "Fields of Packet must be written in wire order");
+            return this->template reserve<Packet<Out, 4>, rpc::WireMany<uint8_t>>(n);
+        }
+
+        inline auto routes(size_t n) &&
+        {
+            static_assert(I == 4, "Fields of Packet must be written in wire order");
+            return this->template reserve<Packet<Out, 5>, Origin<Out>>(n);
+        }
+    };
+
+    template<class Out, size_t I = 0> struct Names: rpc::WireBuilder<Out>
+    {
+        using Names::WireBuilder::WireBuilder;
+        static constexpr size_t fieldCount = 5;
+
+        inline auto _put(uint8_t v) &&
+        {
+            static_assert(I == 0, "Fields of Names must be written in wire order");
+            return this->template put<Names<Out, 1>>(v);
+        }
+
+        inline auto _putFlag(bool v) &&
+        {
+            static_assert(I == 1, "Fields of Names must be written in wire order");
+            return this->template put<Names<Out, 2>>(v);
+        }
+
+        inline auto _reserve(size_t n) &&
+        {
+            static_assert(I == 2, "Fields of Names must be written in wire order");
+            return this->template reserve<Names<Out, 3>, uint8_t>(n);
+        }
+
+        inline auto _nest() &&
+        {
+            static_assert(I == 3, "Fields of Names must be written in wire order");
+            return this->template nest<Names<Out, 4>, Origin<Out>>();
+        }
+
+        inline auto _fieldCount(uint16_t v) &&
+        {
+            static_assert(I == 4, "Fields of Names must be written in wire order");
+            return this->template put<Names<Out, 5>>(v);
+        }
+    };
+
+    template<class Out, size_t I = 0> struct SendCallback: rpc::WireBuilder<Out>
+    {
+        using SendCallback::WireBuilder::WireBuilder;
+        static constexpr size_t fieldCount = 1;
+
+        inline auto retval(bool v) &&
+        {
+            static_assert(I == 0, "Fields of SendCallback must be written in wire order");
+            return this->template put<SendCallback<Out, 1>>(v);
+        }
+    };
+
+    template<class Out, size_t I = 0> struct SendFunction: rpc::WireBuilder<Out>
+    {
+        using SendFunction::WireBuilder::WireBuilder;
+        static constexpr size_t fieldCount = 3;
+
+        inline auto p() &&
+        {
+            static_assert(I == 0, "Fields of SendFunction must be written in wire order");
+            return this->template nest<SendFunction<Out, 1>, Packet<Out>>();
+        }
+
+        inline auto more(size_t n) &&
+        {
+            static_assert(I == 1, "Fields of SendFunction must be written in wire order");
+            return this->template reserve<SendFunction<Out, 2>, Packet<Out>>(n);
+        }
+
+        inline auto callback(const BuildersContract::Parametric::SendCallback<rpc::Many>& v) &&
+        {
+            static_assert(I == 2, "Fields of SendFunction must be written in wire order");
+            return this->template put<SendFunction<Out, 3>>(v);
+        }
+    };
+
+    template<class Out, size_t I = 0> struct DropCall: rpc::WireBuilder<Out>
+    {
+        using DropCall::WireBuilder::WireBuilder;
+        static constexpr size_t fieldCount = 1;
+
+        inline auto id(uint32_t v) &&
+        {
+            static_assert(I == 0, "Fields of DropCall must be written in wire order");
+            return this->template put<DropCall<Out, 1>>(v);
+        }
+    };
+
+    struct ChannelSession
+    {
+        template<class Out, size_t I = 0> struct PostCall: rpc::WireBuilder<Out>
+        {
+            using PostCall::WireBuilder::WireBuilder;
+            static constexpr size_t fieldCount = 1;
+
+            inline auto p() &&
+            {
+                static_assert(I == 0, "Fields of PostCall must be written in wire order");
+                return this->template nest<PostCall<Out, 1>, Packet<Out>>();
+            }
+        };
+
+        template<class Out, size_t I = 0> struct ReceivedCallback: rpc::WireBuilder<Out>
+        {
+            using ReceivedCallback::WireBuilder::WireBuilder;
+            static constexpr size_t fieldCount = 1;
+
+            inline auto count(uint32_t v) &&
+            {
+                static_assert(I == 0, "Fields of ReceivedCallback must be written in wire order");
+                return this->template put<ReceivedCallback<Out, 1>>(v);
+            }
+        };
+
+        template<class Out, size_t I = 0> struct ConnectAccept: rpc::WireBuilder<Out>
+        {
+            using ConnectAccept::WireBuilder::WireBuilder;
+            static constexpr size_t fieldCount = 1;
+
+            inline auto _exports(const BuildersContract::Parametric::ChannelSession::ChannelCallExports<rpc::Many>& v) &&
+            {
+                static_assert(I == 0, "Fields of ConnectAccept must be written in wire order");
+                return this->template put<ConnectAccept<Out, 1>>(v);
+            }
+        };
+
+        template<class Out, size_t I = 0> struct ConnectCreate: rpc::WireBuilder<Out>
+        {
+            using ConnectCreate::WireBuilder::WireBuilder;
+            static constexpr size_t fieldCount = 3;
+
+            inline auto from() &&
+            {
+                static_assert(I == 0, "Fields of ConnectCreate must be written in wire order");
+                return this->template nest<ConnectCreate<Out, 1>, Origin<Out>>();
+            }
+
+            inline auto _exports(const BuildersContract::Parametric::ChannelSession::ChannelCallbackExports<rpc::Many>& v) &&
+            {
+                static_assert(I == 1, "Fields of ConnectCreate must be written in wire order");
+                return this->template put<ConnectCreate<Out, 2>>(v);
+            }
+
+            inline auto _accept(const BuildersContract::Parametric::ChannelSession::ConnectAccept<rpc::Many>& v) &&
+            {
+                static_assert(I == 2, "Fields of ConnectCreate must be written in wire order");
+                return this->template put<ConnectCreate<Out, 3>>(v);
+            }
+        };
+    };
+};
+
+struct BuildersContract::Symbols
+{
+    static constexpr inline auto symSend = rpc::symbol(BuildersContract::Types::SendFunction(), "send"_ctstr);
+    static constexpr inline auto symDrop = rpc::symbol(BuildersContract::Types::DropCall(), "drop"_ctstr);
+
+    struct ChannelSession
+    {
+        static constexpr inline auto symConnect = rpc::symbol(BuildersContract::Types::ChannelSession::ConnectCreate(), "connect"_ctstr);
+    };
+};
+
+
+#endif /* _BUILDERS_H_ */
@@ -0,0 +1,243 @@
+#ifndef _COLUMNS_H_
+#define _COLUMNS_H_
+
+#include <vector>
+
+#include "base/Call.h"
+#include "base/Symbol.h"
+
+#include "types/Collection.h"
+#include "types/StructTypeInfo.h"
+
+#include "framework/Session.h"
+
+struct ColumnsContract
+{
+    class Parametric;
+    class Types;
+    class Symbols;
+    class Columns;
+};
+
+/* Collections of aggregates decoded into columns */
+struct ColumnsContract::Parametric
+{
+    template<template<class> class Collection> struct Reading
+    {
+        uint16_t sensor;
+        bool valid;
+        Collection<uint8_t> unit;
+        int64_t value;
+    };
+
+    template<template<class> class Collection> struct Single
+    {
+        bool only;
+    };
+
+    template<template<class> class Collection> struct Nothing {};
+
+    template<template<class> class Collection> using ReportCall = rpc::Call
+    <
+        /* rs */ Collection<Reading<Collection>>,
+        /* ss */ Collection<Single<Collection>>,
+        /* ns */ Collection<Nothing<Collection>>
+    >;
+};
+
+namespace rpc
+{
+    template<template<class> class Collection> struct TypeInfo<ColumnsContract::Parametric::Reading<Collection>>: StructTypeInfo<
+        ColumnsContract::Parametric::Reading<Collection>,
+        StructMember<&ColumnsContract::Parametric::Reading<Collection>::sensor>,
+        StructMember<&ColumnsContract::Parametric::Reading<Collection>::valid>,
+        StructMember<&ColumnsContract::Parametric::Reading<Collection>::unit>,
+        StructMember<&ColumnsContract::Parametric::Reading<Collection>::value>
+    > {};
+
+    template<template<class> class Collection> struct TypeInfo<ColumnsContract::Parametric::Single<Collection>>: StructTypeInfo<
+        ColumnsContract::Parametric::Single<Collection>,
+        StructMember<&ColumnsContract::Parametric::Single<Collection>::only>
+    > {};
+
+    template<template<class> class Collection> struct TypeInfo<ColumnsContract::Parametric::Nothing<Collection>>: StructTypeInfo<
+        ColumnsContract::Parametric::Nothing<Collection>
+    > {};
+}
+
+struct ColumnsContract::Types
+{
+    using Reading = ColumnsContract::Parametric::Reading<rpc::Many>;
+    using Single = ColumnsContract::Parametric::Single<rpc::Many>;
+    using Nothing = ColumnsContract::Parametric::Nothing<rpc::Many>;
+    using ReportCall = ColumnsContract::Parametric::ReportCall<rpc::Many>;
+};
+
+struct ColumnsContract::Columns
+{
+    template<template<class> class Collection> struct Reading
+    {
+        std::vector<uint16_t> sensor;
+        std::vector<uint8_t> valid;
+        std::vector<Collection<uint8_t>> unit;
+        std::vector<int64_t> value;
+
+        inline size_t size() const { return sensor.size(); }
+
+        inline void resize(size_t n)
+        {
+            sensor.resize(n);
+            valid.resize(n);
+            unit.resize(n);
+            value.resize(n);
+        }
+    };
+
+    template<template<class> class Collection> struct Single
+    {
+        std::vector<uint8_t> only;
+
+        inline size_t size() const { return only.size(); }
+
+        inline void resize(size_t n)
+        {
+            only.resize(n);
+        }
+    };
+};
+
+namespace rpc
+{
+    template<template<class> class Collection> struct TypeInfo<ColumnsContract::Columns::Reading<Collection>>
+    {
+        static constexpr auto sgn = TypeInfo<Collection<ColumnsContract::Parametric::Reading<Collection>>>::sgn;
+        static constexpr bool isFixedSize = false;
+
+        static inline size_t size(const ColumnsContract::Columns::Reading<Collection>& v)
+        {
+            auto ret = collectionHeaderSize(v.size()) + v.size() * 11;
+
+            for(size_t i = 0; i < v.size(); i++)
+            {
+                ret += TypeInfo<Collection<uint8_t>>::size(v.unit[i]);
+            }
+
+            return ret;
+        }
+
+        template<class S>
+        static inline bool write(S& s, const ColumnsContract::Columns::Reading<Collection>& v)
+        {
+            if(!writeCollectionHeader(s, v.size()))
+            {
+                return false;
+            }
+
+            for(size_t i = 0; i < v.size(); i++)
+            {
+                if(!(TypeInfo<uint16_t>::write(s, v.sensor[i])
+                    && TypeInfo<uint8_t>::write(s, v.valid[i])
+                    && TypeInfo<Collection<uint8_t>>::write(s, v.unit[i])
+                    && TypeInfo<int64_t>::write(s, v.value[i])))
+                {
+                    return false;
+                }
+            }
+
+            return true;
+        }
+
+        template<class S>
+        static inline bool read(S& s, ColumnsContract::Columns::Reading<Collection>& v)
+        {
+            size_t n;
+
+            if(!readCollectionHeader(s, n))
+            {
+                return false;
+            }
+
+            v.resize(0);
+
+            for(size_t i = 0; i < n; i++)
+            {
+                v.resize(i + 1);
+
+                if(!(TypeInfo<uint16_t>::read(s, v.sensor[i])
+                    && TypeInfo<uint8_t>::read(s, v.valid[i])
+                    && TypeInfo<Collection<uint8_t>>::read(s, v.unit[i])
+                    && TypeInfo<int64_t>::read(s, v.value[i])))
+                {
+                    return false;
+                }
+            }
+
+            return true;
+        }
+    };
+
+    template<template<class> class Collection> struct TypeInfo<ColumnsContract::Columns::Single<Collection>>
+    {
+        static constexpr auto sgn = TypeInfo<Collection<ColumnsContract::Parametric::Single<Collection>>>::sgn;
+        static constexpr bool isFixedSize = false;
+
+        static inline size_t size(const ColumnsContract::Columns::Single<Collection>& v)
+        {
+            auto ret = collectionHeaderSize(v.size()) + v.size() * 1;
+
+            return ret;
+        }
+
+        template<class S>
+        static inline bool write(S& s, const ColumnsContract::Columns::Single<Collection>& v)
+        {
+            if(!writeCollectionHeader(s, v.size()))
+            {
+                return false;
+            }
+
+            for(size_t i = 0; i < v.size(); i++)
+            {
+                if(!(TypeInfo<uint8_t>::write(s, v.only[i])))
+                {
+                    return false;
+                }
+            }
+
+            return true;
+        }
+
+        template<class S>
+        static inline bool read(S& s, ColumnsContract::Columns::Single<Collection>& v)
+        {
+            size_t n;
+
+            if(!readCollectionHeader(s, n))
+            {
+                return false;
+            }
+
+            v.resize(0);
+
+            for(size_t i = 0; i < n; i++)
+            {
+                v.resize(i + 1);
+
+                if(!(TypeInfo<uint8_t>::read(s, v.only[i])))
+                {
+                    return false;
+                }
+            }
+
+            return true;
+        }
+    };
+}
+
+struct ColumnsContract::Symbols
+{
+    static constexpr inline auto symReport = rpc::symbol(ColumnsContract::Types::ReportCall(), "report"_ctstr);
+};
+
+
+#endif /* _COLUMNS_H_ */
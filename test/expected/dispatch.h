@@ -0,0 +1,189 @@
+#ifndef _DISPATCH_H_
+#define _DISPATCH_H_
+
+#include "base/Call.h"
+#include "base/Symbol.h"
+
+#include "types/Collection.h"
+#include "types/StructTypeInfo.h"
+
+#include "framework/Session.h"
+#include "framework/Service.h"
+
+struct DispatchContract
+{
+    class Parametric;
+    class Types;
+    class Symbols;
+    template<class, class> class ServerProxy;
+};
+
+/* Statically dispatched service */
+struct DispatchContract::Parametric
+{
+    template<template<class> class Collection> struct Request
+    {
+        uint32_t id;
+        Collection<uint8_t> body;
+    };
+
+    template<template<class> class Collection> using HandleCallback = rpc::Call</* retval */ bool>;
+    template<template<class> class Collection> using HandleFunction = rpc::Call
+    <
+        /* r        */ Request<Collection>,
+        /* callback */ HandleCallback<Collection>
+    >;
+
+    template<template<class> class Collection> using ResetCall = rpc::Call<>;
+
+    struct LogSession
+    {
+        template<template<class> class Collection> using AppendCall = rpc::Call</* line */ Collection<uint8_t>>;
+        template<template<class> class Collection> using FlushedCallback = rpc::Call</* count */ uint32_t>;
+
+        template<template<class> class Collection> struct LogCallExports
+        {
+            AppendCall<Collection> append;
+            rpc::Call<> _close;
+        };
+
+        template<template<class> class Collection> struct LogCallbackExports
+        {
+            FlushedCallback<Collection> flushed;
+            rpc::Call<> _close;
+        };
+
+        template<template<class> class Collection> using OpenAccept = rpc::Call
+        <
+            /* _retval  */ uint32_t,
+            /* _exports */ LogCallExports<Collection>
+        >;
+        template<template<class> class Collection> using OpenCreate = rpc::Call
+        <
+            /* level    */ uint8_t,
+            /* _exports */ LogCallbackExports<Collection>,
+            /* _accept  */ OpenAccept<Collection>
+        >;
+    };
+};
+
+namespace rpc
+{
+    template<template<class> class Collection> struct TypeInfo<DispatchContract::Parametric::Request<Collection>>: StructTypeInfo<
+        DispatchContract::Parametric::Request<Collection>,
+        StructMember<&DispatchContract::Parametric::Request<Collection>::id>,
+        StructMember<&DispatchContract::Parametric::Request<Collection>::body>
+    > {};
+
+    template<template<class> class Collection> struct TypeInfo<DispatchContract::Parametric::LogSession::LogCallExports<Collection>>: StructTypeInfo<
+        DispatchContract::Parametric::LogSession::LogCallExports<Collection>,
+        StructMember<&DispatchContract::Parametric::LogSession::LogCallExports<Collection>::append>,
+        StructMember<&DispatchContract::Parametric::LogSession::LogCallExports<Collection>::_close>
+    > {};
+
+    template<template<class> class Collection> struct TypeInfo<DispatchContract::Parametric::LogSession::LogCallbackExports<Collection>>: StructTypeInfo<
+        DispatchContract::Parametric::LogSession::LogCallbackExports<Collection>,
+        StructMember<&DispatchContract::Parametric::LogSession::LogCallbackExports<Collection>::flushed>,
+        StructMember<&DispatchContract::Parametric::LogSession::LogCallbackExports<Collection>::_close>
+    > {};
+}
+
+struct DispatchContract::Types
+{
+    using Request = DispatchContract::Parametric::Request<rpc::Many>;
+    using HandleFunction = DispatchContract::Parametric::HandleFunction<rpc::Many>;
+    using ResetCall = DispatchContract::Parametric::ResetCall<rpc::Many>;
+
+    struct LogSession
+    {
+        using LogCallExports = DispatchContract::Parametric::LogSession::LogCallExports<rpc::Many>;
+        using LogCallbackExports = DispatchContract::Parametric::LogSession::LogCallbackExports<rpc::Many>;
+        using OpenAccept = DispatchContract::Parametric::LogSession::OpenAccept<rpc::Many>;
+        using OpenCreate = DispatchContract::Parametric::LogSession::OpenCreate<rpc::Many>;
+        using AppendCall = DispatchContract::Parametric::LogSession::AppendCall<rpc::Many>;
+        using FlushedCallback = DispatchContract::Parametric::LogSession::FlushedCallback<rpc::Many>;
+    };
+};
+
+struct DispatchContract::Symbols
+{
+    static constexpr inline auto symHandle = rpc::symbol(DispatchContract::Types::HandleFunction(), rpc::NumericId<0x588a424f>());
+    static constexpr inline auto symReset = rpc::symbol(DispatchContract::Types::ResetCall(), rpc::NumericId<0x096c6cdf>());
+
+    struct LogSession
+    {
+        static constexpr inline auto symOpen = rpc::symbol(DispatchContract::Types::LogSession::OpenCreate(), rpc::NumericId<0x31451857>());
+    };
+};
+
+template<class Child>
+class DispatchLogServerSession: public rpc::SessionBase<DispatchContract::Types::LogSession::LogCallbackExports, DispatchContract::Types::LogSession::LogCallExports, 1>
+{
+    template<class, class> friend class rpc::StaticServiceBase;
+
+    template<class Ep, class Self>
+    inline auto exportLocal(Ep& ep, Self self)
+    {
+        static_assert(rpc::nArgs<&Child::append> == 1, "Public method append must take 1 argument");
+        static_assert(rpc::isCompatible<rpc::Arg<0, &Child::append>, rpc::CollectionPlaceholder<uint8_t>>(), "Argument #1 of append must have type compatible with '[u1]'");
+        exportCall<&DispatchContract::Types::LogSession::LogCallExports::append, &Child::append, Ep, Self, rpc::Arg<0, &Child::append>>(ep, self);
+        return finalizeExports<&Child::onClosed>(ep, self);
+    }
+
+    auto importRemote(const DispatchContract::Types::LogSession::LogCallbackExports& i)
+    {
+        this->SessionBase::importRemote(i);
+        static_cast<Child*>(this)->onOpened();
+    }
+
+public:
+
+    template<class Ep, class A0>
+    inline auto flushed(Ep& ep, A0&& count)
+    {
+        static_assert(rpc::isCompatible<A0, uint32_t>(), "Argument #1 to flushed must have type compatible with 'u4'");
+        return this->callImported<&DispatchContract::Types::LogSession::LogCallbackExports::flushed>(ep, rpc::forward<A0>(count));
+    }
+};
+
+/* Statically dispatched service */
+template<class Child, class Endpoint>
+struct DispatchContract::ServerProxy: rpc::StaticServiceBase<Endpoint, DispatchContract::ServerProxy<Child, Endpoint>>
+{
+    template<class... Args>
+    ServerProxy(Args&&... args):
+        ServerProxy::StaticServiceBase(rpc::forward<Args>(args)...)
+    {
+        {
+            static_assert(rpc::nArgs<&Child::handle> == 1, "Public method handle must take 1 argument");
+            static_assert(rpc::isCompatible<rpc::Arg<0, &Child::handle>, DispatchContract::Types::Request>(), "Argument #1 to public method handle (r) must have type compatible with 'Request'");
+            static_assert(rpc::isCompatible<rpc::Ret<&Child::handle>, bool>(), "Return type of handle must be compatible with 'bool'");
+        }
+
+        {
+            static_assert(rpc::nArgs<&Child::reset> == 0, "Public method reset must take 0 argument");
+        }
+
+        {
+            static_assert(rpc::nArgs<&Child::open> == 1, "Public method open must take 1 argument");
+            static_assert(rpc::isCompatible<rpc::Arg<0, &Child::open>, uint8_t>(), "Argument #1 to public method open (level) must have type compatible with 'u1'");
+            static_assert(rpc::isCompatible<decltype(rpc::declval<typename rpc::Ret<&Child::open>>().first), uint32_t>(), "Session constructor open for Log session must return a pair whose first member is a value compatible with u4");
+            static_assert(rpc::hasCrtpBase<DispatchLogServerSession, decltype(*rpc::declval<typename rpc::Ret<&Child::open>>().second)>, "Session constructor open for Log session must return a pair whose second member is a pointer-like object to a CRTP subclass of DispatchLogServerSession");
+        }
+    }
+
+    template<class Visitor>
+    static inline auto dispatch(uint32_t id, Visitor&& v)
+    {
+        switch(id)
+        {
+            case 0x096c6cdf: return v.template serveAction<DispatchContract::Symbols::symReset, Child, &Child::reset>();
+            case 0x31451857: return v.template serveCtorWithRetval<DispatchContract::Symbols::LogSession::symOpen, Child, &Child::open, DispatchContract::Types::LogSession::LogCallbackExports, DispatchContract::Types::LogSession::OpenAccept, rpc::Arg<0, &Child::open>>();
+            case 0x588a424f: return v.template serveFunction<DispatchContract::Symbols::symHandle, Child, &Child::handle, bool, rpc::Arg<0, &Child::handle>>();
+            default: return v.unknown();
+        }
+    }
+};
+
+
+#endif /* _DISPATCH_H_ */
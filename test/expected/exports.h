@@ -0,0 +1,275 @@
+#ifndef _EXPORTS_H_
+#define _EXPORTS_H_
+
+#include "base/Call.h"
+#include "base/Symbol.h"
+
+#include "types/Collection.h"
+#include "types/StructTypeInfo.h"
+
+#include "framework/Session.h"
+#include "framework/Client.h"
+#include "framework/Service.h"
+
+struct ExportsContract
+{
+    class Parametric;
+    class Types;
+    class Symbols;
+    template<class> class ClientProxy;
+    template<class, class> class ServerProxy;
+};
+
+/* Sessions with exports tables */
+struct ExportsContract::Parametric
+{
+    struct TransferSession
+    {
+        template<template<class> class Collection> using ChunkCall = rpc::Call</* data */ Collection<uint8_t>>;
+        template<template<class> class Collection> using FinishCall = rpc::Call<>;
+        template<template<class> class Collection> using ProgressCallback = rpc::Call</* done */ uint64_t>;
+        template<template<class> class Collection> using FailedCallback = rpc::Call</* code */ int16_t>;
+
+        template<template<class> class Collection> struct TransferCallExports
+        {
+            ChunkCall<Collection> chunk;
+            FinishCall<Collection> finish;
+            rpc::Call<> _close;
+        };
+
+        template<template<class> class Collection> struct TransferCallbackExports
+        {
+            ProgressCallback<Collection> progress;
+            FailedCallback<Collection> failed;
+            rpc::Call<> _close;
+        };
+
+        template<template<class> class Collection> using UploadAccept = rpc::Call
+        <
+            /* _retval  */ uint32_t,
+            /* _exports */ TransferCallExports<Collection>
+        >;
+        template<template<class> class Collection> using UploadCreate = rpc::Call
+        <
+            /* name     */ Collection<uint8_t>,
+            /* size     */ uint64_t,
+            /* _exports */ TransferCallbackExports<Collection>,
+            /* _accept  */ UploadAccept<Collection>
+        >;
+
+        template<template<class> class Collection> using ResumeAccept = rpc::Call</* _exports */ TransferCallExports<Collection>>;
+        template<template<class> class Collection> using ResumeCreate = rpc::Call
+        <
+            /* id       */ uint32_t,
+            /* _exports */ TransferCallbackExports<Collection>,
+            /* _accept  */ ResumeAccept<Collection>
+        >;
+    };
+};
+
+namespace rpc
+{
+    template<template<class> class Collection> struct TypeInfo<ExportsContract::Parametric::TransferSession::TransferCallExports<Collection>>: StructTypeInfo<
+        ExportsContract::Parametric::TransferSession::TransferCallExports<Collection>,
+        StructMember<&ExportsContract::Parametric::TransferSession::TransferCallExports<Collection>::chunk>,
+        StructMember<&ExportsContract::Parametric::TransferSession::TransferCallExports<Collection>::finish>,
+        StructMember<&ExportsContract::Parametric::TransferSession::TransferCallExports<Collection>::_close>
+    > {};
+
+    template<template<class> class Collection> struct TypeInfo<ExportsContract::Parametric::TransferSession::TransferCallbackExports<Collection>>: StructTypeInfo<
+        ExportsContract::Parametric::TransferSession::TransferCallbackExports<Collection>,
+        StructMember<&ExportsContract::Parametric::TransferSession::TransferCallbackExports<Collection>::progress>,
+        StructMember<&ExportsContract::Parametric::TransferSession::TransferCallbackExports<Collection>::failed>,
+        StructMember<&ExportsContract::Parametric::TransferSession::TransferCallbackExports<Collection>::_close>
+    > {};
+}
+
+struct ExportsContract::Types
+{
+    struct TransferSession
+    {
+        using TransferCallExports = ExportsContract::Parametric::TransferSession::TransferCallExports<rpc::Many>;
+        using TransferCallbackExports = ExportsContract::Parametric::TransferSession::TransferCallbackExports<rpc::Many>;
+        using UploadAccept = ExportsContract::Parametric::TransferSession::UploadAccept<rpc::Many>;
+        using UploadCreate = ExportsContract::Parametric::TransferSession::UploadCreate<rpc::Many>;
+        using ResumeAccept = ExportsContract::Parametric::TransferSession::ResumeAccept<rpc::Many>;
+        using ResumeCreate = ExportsContract::Parametric::TransferSession::ResumeCreate<rpc::Many>;
+        using ChunkCall = ExportsContract::Parametric::TransferSession::ChunkCall<rpc::Many>;
+        using FinishCall = ExportsContract::Parametric::TransferSession::FinishCall<rpc::Many>;
+        using ProgressCallback = ExportsContract::Parametric::TransferSession::ProgressCallback<rpc::Many>;
+        using FailedCallback = ExportsContract::Parametric::TransferSession::FailedCallback<rpc::Many>;
+    };
+};
+
+struct ExportsContract::Symbols
+{
+    struct TransferSession
+    {
+        static constexpr inline auto symUpload = rpc::symbol(ExportsContract::Types::TransferSession::UploadCreate(), "upload"_ctstr);
+        static constexpr inline auto symResume = rpc::symbol(ExportsContract::Types::TransferSession::ResumeCreate(), "resume"_ctstr);
+    };
+};
+
+template<class Child>
+class ExportsTransferClientSession: public rpc::SessionBase<ExportsContract::Types::TransferSession::TransferCallExports, ExportsContract::Types::TransferSession::TransferCallbackExports, 2>
+{
+    template<class> friend class rpc::ClientBase;
+
+    template<class Ep, class Self>
+    inline auto exportLocal(Ep& ep, Self self)
+    {
+        static_assert(rpc::nArgs<&Child::progress> == 1, "Public method progress must take 1 argument");
+        static_assert(rpc::isCompatible<rpc::Arg<0, &Child::progress>, uint64_t>(), "Argument #1 of progress must have type compatible with 'u8'");
+        static_assert(rpc::nArgs<&Child::failed> == 1, "Public method failed must take 1 argument");
+        static_assert(rpc::isCompatible<rpc::Arg<0, &Child::failed>, int16_t>(), "Argument #1 of failed must have type compatible with 'i2'");
+
+        return exportTable<&Child::onClosed, Ep, Self,
+            rpc::ExportEntry<&ExportsContract::Types::TransferSession::TransferCallbackExports::progress, &Child::progress, rpc::Arg<0, &Child::progress>>,
+            rpc::ExportEntry<&ExportsContract::Types::TransferSession::TransferCallbackExports::failed, &Child::failed, rpc::Arg<0, &Child::failed>>
+        >(ep, self);
+    }
+
+    auto importRemote(const ExportsContract::Types::TransferSession::TransferCallExports& i)
+    {
+        this->SessionBase::importRemote(i);
+        static_cast<Child*>(this)->onOpened();
+    }
+
+public:
+
+    template<class Ep, class A0>
+    inline auto chunk(Ep& ep, A0&& data)
+    {
+        static_assert(rpc::isCompatible<A0, rpc::CollectionPlaceholder<uint8_t>>(), "Argument #1 to chunk must have type compatible with '[u1]'");
+        return this->callImported<&ExportsContract::Types::TransferSession::TransferCallExports::chunk>(ep, rpc::forward<A0>(data));
+    }
+
+    template<class Ep>
+    inline auto finish(Ep& ep)
+    {
+        return this->callImported<&ExportsContract::Types::TransferSession::TransferCallExports::finish>(ep);
+    }
+};
+
+/* Sessions with exports tables */
+template<class Adapter> class ExportsContract::ClientProxy: public rpc::ClientBase<Adapter>
+{
+    template<class T> using Link = typename rpc::ClientBase<Adapter>::template OnDemand<T>;
+    Link<decltype(ExportsContract::Symbols::TransferSession::symUpload)> idTransferUpload = ExportsContract::Symbols::TransferSession::symUpload;
+    Link<decltype(ExportsContract::Symbols::TransferSession::symResume)> idTransferResume = ExportsContract::Symbols::TransferSession::symResume;
+
+public:
+    using ClientProxy::ClientBase::ClientBase;
+
+    template<class S, class A0, class A1, class C>
+    inline auto upload(S _object, A0&& name, A1&& size, C&& _cb)
+    {
+        static_assert(rpc::hasCrtpBase<ExportsTransferClientSession, decltype(*_object)>, "The first argument to upload must be a pointer-like object to a CRTP subclass of ExportsTransferClientSession");
+        static_assert(rpc::isCompatible<A0, rpc::CollectionPlaceholder<uint8_t>>(), "Argument #2 to upload must have type compatible with '[u1]'");
+        static_assert(rpc::isCompatible<A1, uint64_t>(), "Argument #3 to upload must have type compatible with 'u8'");
+        static_assert(rpc::isCompatible<rpc::Arg<0, &C::operator()>, uint32_t>(), "Callback for upload must take an argument compatible with 'u4'");
+        return this->createWithCallbackRetval(idTransferUpload, _object, rpc::move(_cb), rpc::forward<A0>(name), rpc::forward<A1>(size));
+    }
+
+    template<class Ret, class S, class A0, class A1>
+    inline auto upload(S _object, A0&& name, A1&& size)
+    {
+        static_assert(rpc::hasCrtpBase<ExportsTransferClientSession, decltype(*_object)>, "The first argument to upload must be a pointer-like object to a CRTP subclass of ExportsTransferClientSession");
+        static_assert(rpc::isCompatible<A0, rpc::CollectionPlaceholder<uint8_t>>(), "Argument #2 to upload (name) must have type compatible with '[u1]'");
+        static_assert(rpc::isCompatible<A1, uint64_t>(), "Argument #3 to upload (size) must have type compatible with 'u8'");
+        static_assert(rpc::isCompatible<Ret, uint32_t>(), "Return type of upload must be compatible with 'u4'");
+        return this->template createWithPromiseRetval<Ret>(idTransferUpload, _object, rpc::forward<A0>(name), rpc::forward<A1>(size));
+    }
+
+    template<class S, class A0, class C>
+    inline auto resume(S _object, A0&& id, C&& _cb)
+    {
+        static_assert(rpc::hasCrtpBase<ExportsTransferClientSession, decltype(*_object)>, "The first argument to resume must be a pointer-like object to a CRTP subclass of ExportsTransferClientSession");
+        static_assert(rpc::isCompatible<A0, uint32_t>(), "Argument #2 to resume must have type compatible with 'u4'");
+        return this->createWithCallback(idTransferResume, _object, rpc::move(_cb), rpc::forward<A0>(id));
+    }
+
+    template<class S, class A0>
+    inline auto resume(S _object, A0&& id)
+    {
+        static_assert(rpc::hasCrtpBase<ExportsTransferClientSession, decltype(*_object)>, "The first argument to resume must be a pointer-like object to a CRTP subclass of ExportsTransferClientSession");
+        static_assert(rpc::isCompatible<A0, uint32_t>(), "Argument #2 to resume (id) must have type compatible with 'u4'");
+        return this->createWithPromise(idTransferResume, _object, rpc::forward<A0>(id));
+    }
+};
+
+template<class Child>
+class ExportsTransferServerSession: public rpc::SessionBase<ExportsContract::Types::TransferSession::TransferCallbackExports, ExportsContract::Types::TransferSession::TransferCallExports, 2>
+{
+    template<class> friend class rpc::ServiceBase;
+
+    template<class Ep, class Self>
+    inline auto exportLocal(Ep& ep, Self self)
+    {
+        static_assert(rpc::nArgs<&Child::chunk> == 1, "Public method chunk must take 1 argument");
+        static_assert(rpc::isCompatible<rpc::Arg<0, &Child::chunk>, rpc::CollectionPlaceholder<uint8_t>>(), "Argument #1 of chunk must have type compatible with '[u1]'");
+        static_assert(rpc::nArgs<&Child::finish> == 0, "Public method finish must take 0 argument");
+
+        return exportTable<&Child::onClosed, Ep, Self,
+            rpc::ExportEntry<&ExportsContract::Types::TransferSession::TransferCallExports::chunk, &Child::chunk, rpc::Arg<0, &Child::chunk>>,
+            rpc::ExportEntry<&ExportsContract::Types::TransferSession::TransferCallExports::finish, &Child::finish>
+        >(ep, self);
+    }
+
+    auto importRemote(const ExportsContract::Types::TransferSession::TransferCallbackExports& i)
+    {
+        this->SessionBase::importRemote(i);
+        static_cast<Child*>(this)->onOpened();
+    }
+
+public:
+
+    template<class Ep, class A0>
+    inline auto progress(Ep& ep, A0&& done)
+    {
+        static_assert(rpc::isCompatible<A0, uint64_t>(), "Argument #1 to progress must have type compatible with 'u8'");
+        return this->callImported<&ExportsContract::Types::TransferSession::TransferCallbackExports::progress>(ep, rpc::forward<A0>(done));
+    }
+
+    template<class Ep, class A0>
+    inline auto failed(Ep& ep, A0&& code)
+    {
+        static_assert(rpc::isCompatible<A0, int16_t>(), "Argument #1 to failed must have type compatible with 'i2'");
+        return this->callImported<&ExportsContract::Types::TransferSession::TransferCallbackExports::failed>(ep, rpc::forward<A0>(code));
+    }
+};
+
+/* Sessions with exports tables */
+template<class Child, class Endpoint>
+struct ExportsContract::ServerProxy: rpc::ServiceBase<Endpoint>
+{
+    template<class... Args>
+    ServerProxy(Args&&... args):
+        ServerProxy::ServiceBase(rpc::forward<Args>(args)...)
+    {
+        {
+            static_assert(rpc::nArgs<&Child::upload> == 2, "Public method upload must take 2 arguments");
+            static_assert(rpc::isCompatible<rpc::Arg<0, &Child::upload>, rpc::CollectionPlaceholder<uint8_t>>(), "Argument #1 to public method upload (name) must have type compatible with '[u1]'");
+            static_assert(rpc::isCompatible<rpc::Arg<1, &Child::upload>, uint64_t>(), "Argument #2 to public method upload (size) must have type compatible with 'u8'");
+            static_assert(rpc::isCompatible<decltype(rpc::declval<typename rpc::Ret<&Child::upload>>().first), uint32_t>(), "Session constructor upload for Transfer session must return a pair whose first member is a value compatible with u4");
+            static_assert(rpc::hasCrtpBase<ExportsTransferServerSession, decltype(*rpc::declval<typename rpc::Ret<&Child::upload>>().second)>, "Session constructor upload for Transfer session must return a pair whose second member is a pointer-like object to a CRTP subclass of ExportsTransferServerSession");
+            this->template provideCtorWithRetval<ExportsContract::Symbols::TransferSession::symUpload, Child, &Child::upload, ExportsContract::Types::TransferSession::TransferCallbackExports, ExportsContract::Types::TransferSession::UploadAccept, rpc::Arg<0, &Child::upload>, rpc::Arg<1, &Child::upload>>();
+        }
+
+        {
+            static_assert(rpc::nArgs<&Child::resume> == 1, "Public method resume must take 1 argument");
+            static_assert(rpc::isCompatible<rpc::Arg<0, &Child::resume>, uint32_t>(), "Argument #1 to public method resume (id) must have type compatible with 'u4'");
+            static_assert(rpc::hasCrtpBase<ExportsTransferServerSession, decltype(*rpc::declval<rpc::Ret<&Child::resume>>())>, "Session constructor resume for Transfer session must return a pointer-like object to a CRTP subclass of ExportsTransferServerSession");
+            this->template provideCtor<ExportsContract::Symbols::TransferSession::symResume, Child, &Child::resume, ExportsContract::Types::TransferSession::TransferCallbackExports, ExportsContract::Types::TransferSession::ResumeAccept, rpc::Arg<0, &Child::resume>>();
+        }
+    }
+
+    ~ServerProxy()
+    {
+        this->discard(ExportsContract::Symbols::TransferSession::symUpload);
+        this->discard(ExportsContract::Symbols::TransferSession::symResume);
+    }
+};
+
+
+#endif /* _EXPORTS_H_ */
@@ -0,0 +1,124 @@
+#ifndef _HINTS_H_
+#define _HINTS_H_
+
+#include "base/Call.h"
+#include "base/Symbol.h"
+
+#include "types/Collection.h"
+#include "types/StructTypeInfo.h"
+
+#include "framework/Session.h"
+
+struct HintsContract
+{
+    class Parametric;
+    class Types;
+    class Symbols;
+};
+
+/* Usage hints */
+struct HintsContract::Parametric
+{
+    template<template<class> class Collection> using Blob = Collection<uint8_t>;
+
+    template<template<class> class Collection> struct Record
+    {
+        uint32_t id;
+        Collection<uint8_t> data;
+        Collection<uint16_t> tags;
+    };
+
+    template<template<class> class Collection> using StoreCallback = rpc::Call</* retval */ bool>;
+    template<template<class> class Collection> using StoreFunction = rpc::Call
+    <
+        /* r        */ Record<Collection>,
+        /* extra    */ Blob<Collection>,
+        /* callback */ StoreCallback<Collection>
+    >;
+
+    template<template<class> class Collection> using FlushCall = rpc::Call<>;
+
+    struct FeedSession
+    {
+        template<template<class> class Collection> using PushCall = rpc::Call</* chunk */ Blob<Collection>>;
+        template<template<class> class Collection> using DeliveredCallback = rpc::Call</* count */ uint32_t>;
+
+        template<template<class> class Collection> struct FeedCallExports
+        {
+            PushCall<Collection> push;
+            rpc::Call<> _close;
+        };
+
+        template<template<class> class Collection> struct FeedCallbackExports
+        {
+            DeliveredCallback<Collection> delivered;
+            rpc::Call<> _close;
+        };
+
+        template<template<class> class Collection> using SubscribeAccept = rpc::Call
+        <
+            /* _retval  */ uint32_t,
+            /* _exports */ FeedCallExports<Collection>
+        >;
+        template<template<class> class Collection> using SubscribeCreate = rpc::Call
+        <
+            /* from     */ uint64_t,
+            /* _exports */ FeedCallbackExports<Collection>,
+            /* _accept  */ SubscribeAccept<Collection>
+        >;
+    };
+};
+
+namespace rpc
+{
+    template<template<class> class Collection> struct TypeInfo<HintsContract::Parametric::Record<Collection>>: StructTypeInfo<
+        HintsContract::Parametric::Record<Collection>,
+        StructMember<&HintsContract::Parametric::Record<Collection>::id>,
+        StructMember<&HintsContract::Parametric::Record<Collection>::data>,
+        StructMember<&HintsContract::Parametric::Record<Collection>::tags>
+    > {};
+
+    template<template<class> class Collection> struct TypeInfo<HintsContract::Parametric::FeedSession::FeedCallExports<Collection>>: StructTypeInfo<
+        HintsContract::Parametric::FeedSession::FeedCallExports<Collection>,
+        StructMember<&HintsContract::Parametric::FeedSession::FeedCallExports<Collection>::push>,
+        StructMember<&HintsContract::Parametric::FeedSession::FeedCallExports<Collection>::_close>
+    > {};
+
+    template<template<class> class Collection> struct TypeInfo<HintsContract::Parametric::FeedSession::FeedCallbackExports<Collection>>: StructTypeInfo<
+        HintsContract::Parametric::FeedSession::FeedCallbackExports<Collection>,
+        StructMember<&HintsContract::Parametric::FeedSession::FeedCallbackExports<Collection>::delivered>,
+        StructMember<&HintsContract::Parametric::FeedSession::FeedCallbackExports<Collection>::_close>
+    > {};
+}
+
+struct HintsContract::Types
+{
+    using Blob = HintsContract::Parametric::Blob<rpc::Many>;
+    using Record = HintsContract::Parametric::Record<rpc::Many>;
+    using StoreFunction = HintsContract::Parametric::StoreFunction<rpc::Many>;
+    using FlushCall = HintsContract::Parametric::FlushCall<rpc::Many>;
+
+    struct FeedSession
+    {
+        using FeedCallExports = HintsContract::Parametric::FeedSession::FeedCallExports<rpc::Many>;
+        using FeedCallbackExports = HintsContract::Parametric::FeedSession::FeedCallbackExports<rpc::Many>;
+        using SubscribeAccept = HintsContract::Parametric::FeedSession::SubscribeAccept<rpc::Many>;
+        using SubscribeCreate = HintsContract::Parametric::FeedSession::SubscribeCreate<rpc::Many>;
+        using PushCall = HintsContract::Parametric::FeedSession::PushCall<rpc::Many>;
+        using DeliveredCallback = HintsContract::Parametric::FeedSession::DeliveredCallback<rpc::Many>;
+    };
+};
+
+struct HintsContract::Symbols
+{
+    static constexpr inline auto symStore = rpc::symbol(HintsContract::Types::StoreFunction(), "store"_ctstr);
+    static constexpr inline auto symFlush = rpc::symbol(HintsContract::Types::FlushCall(), "flush"_ctstr);
+
+    struct FeedSession
+    {
+        static constexpr inline auto symSubscribe = rpc::symbol(HintsContract::Types::FeedSession::SubscribeCreate(), "subscribe"_ctstr);
+    };
+};
+
+
+#endif /* _HINTS_H_ */
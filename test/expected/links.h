@@ -0,0 +1,214 @@
+#ifndef _LINKS_H_
+#define _LINKS_H_
+
+#include "base/Call.h"
+#include "base/Symbol.h"
+
+#include "types/Collection.h"
+#include "types/StructTypeInfo.h"
+
+#include "framework/Session.h"
+#include "framework/Client.h"
+
+struct LinksContract
+{
+    class Parametric;
+    class Types;
+    class Symbols;
+    template<class> class ClientProxy;
+    template<class> struct ClientLinks;
+};
+
+/* Client on shared links */
+struct LinksContract::Parametric
+{
+    template<template<class> class Collection> struct Query
+    {
+        uint32_t key;
+        Collection<uint8_t> prefix;
+    };
+
+    template<template<class> class Collection> using FindCallback = rpc::Call</* retval */ Collection<uint32_t>>;
+    template<template<class> class Collection> using FindFunction = rpc::Call
+    <
+        /* q        */ Query<Collection>,
+        /* callback */ FindCallback<Collection>
+    >;
+
+    template<template<class> class Collection> using PingCall = rpc::Call<>;
+
+    struct WatchSession
+    {
+        template<template<class> class Collection> using CancelCall = rpc::Call<>;
+        template<template<class> class Collection> using ChangedCallback = rpc::Call</* key */ uint32_t>;
+
+        template<template<class> class Collection> struct WatchCallExports
+        {
+            CancelCall<Collection> cancel;
+            rpc::Call<> _close;
+        };
+
+        template<template<class> class Collection> struct WatchCallbackExports
+        {
+            ChangedCallback<Collection> changed;
+            rpc::Call<> _close;
+        };
+
+        template<template<class> class Collection> using WatchAccept = rpc::Call
+        <
+            /* _retval  */ uint32_t,
+            /* _exports */ WatchCallExports<Collection>
+        >;
+        template<template<class> class Collection> using WatchCreate = rpc::Call
+        <
+            /* q        */ Query<Collection>,
+            /* _exports */ WatchCallbackExports<Collection>,
+            /* _accept  */ WatchAccept<Collection>
+        >;
+    };
+};
+
+namespace rpc
+{
+    template<template<class> class Collection> struct TypeInfo<LinksContract::Parametric::Query<Collection>>: StructTypeInfo<
+        LinksContract::Parametric::Query<Collection>,
+        StructMember<&LinksContract::Parametric::Query<Collection>::key>,
+        StructMember<&LinksContract::Parametric::Query<Collection>::prefix>
+    > {};
+
+    template<template<class> class Collection> struct TypeInfo<LinksContract::Parametric::WatchSession::WatchCallExports<Collection>>: StructTypeInfo<
+        LinksContract::Parametric::WatchSession::WatchCallExports<Collection>,
+        StructMember<&LinksContract::Parametric::WatchSession::WatchCallExports<Collection>::cancel>,
+        StructMember<&LinksContract::Parametric::WatchSession::WatchCallExports<Collection>::_close>
+    > {};
+
+    template<template<class> class Collection> struct TypeInfo<LinksContract::Parametric::WatchSession::WatchCallbackExports<Collection>>: StructTypeInfo<
+        LinksContract::Parametric::WatchSession::WatchCallbackExports<Collection>,
+        StructMember<&LinksContract::Parametric::WatchSession::WatchCallbackExports<Collection>::changed>,
+        StructMember<&LinksContract::Parametric::WatchSession::WatchCallbackExports<Collection>::_close>
+    > {};
+}
+
+struct LinksContract::Types
+{
+    using Query = LinksContract::Parametric::Query<rpc::Many>;
+    using FindFunction = LinksContract::Parametric::FindFunction<rpc::Many>;
+    using PingCall = LinksContract::Parametric::PingCall<rpc::Many>;
+
+    struct WatchSession
+    {
+        using WatchCallExports = LinksContract::Parametric::WatchSession::WatchCallExports<rpc::Many>;
+        using WatchCallbackExports = LinksContract::Parametric::WatchSession::WatchCallbackExports<rpc::Many>;
+        using WatchAccept = LinksContract::Parametric::WatchSession::WatchAccept<rpc::Many>;
+        using WatchCreate = LinksContract::Parametric::WatchSession::WatchCreate<rpc::Many>;
+        using CancelCall = LinksContract::Parametric::WatchSession::CancelCall<rpc::Many>;
+        using ChangedCallback = LinksContract::Parametric::WatchSession::ChangedCallback<rpc::Many>;
+    };
+};
+
+struct LinksContract::Symbols
+{
+    static constexpr inline auto symFind = rpc::symbol(LinksContract::Types::FindFunction(), "find"_ctstr);
+    static constexpr inline auto symPing = rpc::symbol(LinksContract::Types::PingCall(), "ping"_ctstr);
+
+    struct WatchSession
+    {
+        static constexpr inline auto symWatch = rpc::symbol(LinksContract::Types::WatchSession::WatchCreate(), "watch"_ctstr);
+    };
+};
+
+template<class Child>
+class LinksWatchClientSession: public rpc::SessionBase<LinksContract::Types::WatchSession::WatchCallExports, LinksContract::Types::WatchSession::WatchCallbackExports, 1>
+{
+    template<class, class> friend class rpc::SharedLinkClientBase;
+
+    template<class Ep, class Self>
+    inline auto exportLocal(Ep& ep, Self self)
+    {
+        static_assert(rpc::nArgs<&Child::changed> == 1, "Public method changed must take 1 argument");
+        static_assert(rpc::isCompatible<rpc::Arg<0, &Child::changed>, uint32_t>(), "Argument #1 of changed must have type compatible with 'u4'");
+        exportCall<&LinksContract::Types::WatchSession::WatchCallbackExports::changed, &Child::changed, Ep, Self, rpc::Arg<0, &Child::changed>>(ep, self);
+        return finalizeExports<&Child::onClosed>(ep, self);
+    }
+
+    auto importRemote(const LinksContract::Types::WatchSession::WatchCallExports& i)
+    {
+        this->SessionBase::importRemote(i);
+        static_cast<Child*>(this)->onOpened();
+    }
+
+public:
+
+    template<class Ep>
+    inline auto cancel(Ep& ep)
+    {
+        return this->callImported<&LinksContract::Types::WatchSession::WatchCallExports::cancel>(ep);
+    }
+};
+
+template<class Adapter> struct LinksContract::ClientLinks
+{
+    template<class T> using Link = typename rpc::ClientBase<Adapter>::template OnDemand<T>;
+    Link<decltype(LinksContract::Symbols::symFind)> idFind = LinksContract::Symbols::symFind;
+    Link<decltype(LinksContract::Symbols::symPing)> idPing = LinksContract::Symbols::symPing;
+    Link<decltype(LinksContract::Symbols::WatchSession::symWatch)> idWatchWatch = LinksContract::Symbols::WatchSession::symWatch;
+};
+
+/* Client on shared links */
+template<class Adapter> class LinksContract::ClientProxy: public rpc::SharedLinkClientBase<Adapter, LinksContract::ClientLinks<Adapter>>
+{
+    using Links = LinksContract::ClientLinks<Adapter>;
+    static constexpr auto idFind = &Links::idFind;
+    static constexpr auto idPing = &Links::idPing;
+    static constexpr auto idWatchWatch = &Links::idWatchWatch;
+
+public:
+    using ClientProxy::SharedLinkClientBase::SharedLinkClientBase;
+
+    inline auto prefetchAll()
+    {
+        return this->prefetch(idFind, idPing, idWatchWatch);
+    }
+
+    template<class A0, class C>
+    inline auto find(A0&& q, C&& _cb)
+    {
+        static_assert(rpc::isCompatible<A0, LinksContract::Types::Query>(), "Argument #1 of find (q) must have type compatible with 'Query'");
+        static_assert(rpc::isCompatible<rpc::Arg<0, &C::operator()>, rpc::CollectionPlaceholder<uint32_t>>(), "Callback for find must take a first argument compatible with '[u4]'");
+        return this->callWithCallback(idFind, rpc::move(_cb), rpc::forward<A0>(q));
+    }
+
+    template<class Ret, class A0>
+    inline auto find(A0&& q)
+    {
+        static_assert(rpc::isCompatible<A0, LinksContract::Types::Query>(), "Argument #1 of find (q) must have type compatible with 'Query'");
+        static_assert(rpc::isCompatible<Ret, rpc::CollectionPlaceholder<uint32_t>>(), "Return type of find must be compatible with '[u4]'");
+        return this->template callWithPromise<Ret>(idFind, rpc::forward<A0>(q));
+    }
+
+    inline auto ping()
+    {
+        return this->callAction(idPing);
+    }
+
+    template<class S, class A0, class C>
+    inline auto watch(S _object, A0&& q, C&& _cb)
+    {
+        static_assert(rpc::hasCrtpBase<LinksWatchClientSession, decltype(*_object)>, "The first argument to watch must be a pointer-like object to a CRTP subclass of LinksWatchClientSession");
+        static_assert(rpc::isCompatible<A0, LinksContract::Types::Query>(), "Argument #2 to watch must have type compatible with 'Query'");
+        static_assert(rpc::isCompatible<rpc::Arg<0, &C::operator()>, uint32_t>(), "Callback for watch must take an argument compatible with 'u4'");
+        return this->createWithCallbackRetval(idWatchWatch, _object, rpc::move(_cb), rpc::forward<A0>(q));
+    }
+
+    template<class Ret, class S, class A0>
+    inline auto watch(S _object, A0&& q)
+    {
+        static_assert(rpc::hasCrtpBase<LinksWatchClientSession, decltype(*_object)>, "The first argument to watch must be a pointer-like object to a CRTP subclass of LinksWatchClientSession");
+        static_assert(rpc::isCompatible<A0, LinksContract::Types::Query>(), "Argument #2 to watch (q) must have type compatible with 'Query'");
+        static_assert(rpc::isCompatible<Ret, uint32_t>(), "Return type of watch must be compatible with 'u4'");
+        return this->template createWithPromiseRetval<Ret>(idWatchWatch, _object, rpc::forward<A0>(q));
+    }
+};
+
+
+#endif /* _LINKS_H_ */
@@ -0,0 +1,18 @@
+module;
+
+#include "base/Call.h"
+#include "base/Symbol.h"
+
+#include "types/Collection.h"
+#include "types/StructTypeInfo.h"
+
+#include "framework/Session.h"
+
+module Geometry;
+
+template struct ModulesContract::Parametric::Point<rpc::Many>;
+template struct rpc::TypeInfo<ModulesContract::Parametric::Point<rpc::Many>>;
+template struct ModulesContract::Parametric::TrackerSession::TrackerCallExports<rpc::Many>;
+template struct rpc::TypeInfo<ModulesContract::Parametric::TrackerSession::TrackerCallExports<rpc::Many>>;
+template struct ModulesContract::Parametric::TrackerSession::TrackerCallbackExports<rpc::Many>;
+template struct rpc::TypeInfo<ModulesContract::Parametric::TrackerSession::TrackerCallbackExports<rpc::Many>>;
@@ -0,0 +1,112 @@
+module;
+
+#include "base/Call.h"
+#include "base/Symbol.h"
+
+#include "types/Collection.h"
+#include "types/StructTypeInfo.h"
+
+#include "framework/Session.h"
+
+export module Geometry;
+
+export struct ModulesContract
+{
+    class Parametric;
+    class Types;
+    class Symbols;
+};
+
+/* Module interface */
+struct ModulesContract::Parametric
+{
+    template<template<class> class Collection> struct Point
+    {
+        int32_t x;
+        int32_t y;
+    };
+
+    template<template<class> class Collection> using LocateCallback = rpc::Call</* retval */ uint32_t>;
+    template<template<class> class Collection> using LocateFunction = rpc::Call
+    <
+        /* p        */ Point<Collection>,
+        /* callback */ LocateCallback<Collection>
+    >;
+
+    struct TrackerSession
+    {
+        template<template<class> class Collection> using MovedCallback = rpc::Call</* to */ Point<Collection>>;
+
+        template<template<class> class Collection> struct TrackerCallExports
+        {
+            rpc::Call<> _close;
+        };
+
+        template<template<class> class Collection> struct TrackerCallbackExports
+        {
+            MovedCallback<Collection> moved;
+            rpc::Call<> _close;
+        };
+
+        template<template<class> class Collection> using TrackAccept = rpc::Call</* _exports */ TrackerCallExports<Collection>>;
+        template<template<class> class Collection> using TrackCreate = rpc::Call
+        <
+            /* from     */ Point<Collection>,
+            /* _exports */ TrackerCallbackExports<Collection>,
+            /* _accept  */ TrackAccept<Collection>
+        >;
+    };
+};
+
+namespace rpc
+{
+    template<template<class> class Collection> struct TypeInfo<ModulesContract::Parametric::Point<Collection>>: StructTypeInfo<
+        ModulesContract::Parametric::Point<Collection>,
+        StructMember<&ModulesContract::Parametric::Point<Collection>::x>,
+        StructMember<&ModulesContract::Parametric::Point<Collection>::y>
+    > {};
+
+    template<template<class> class Collection> struct TypeInfo<ModulesContract::Parametric::TrackerSession::TrackerCallExports<Collection>>: StructTypeInfo<
+        ModulesContract::Parametric::TrackerSession::TrackerCallExports<Collection>,
+        StructMember<&ModulesContract::Parametric::TrackerSession::TrackerCallExports<Collection>::_close>
+    > {};
+
+    template<template<class> class Collection> struct TypeInfo<ModulesContract::Parametric::TrackerSession::TrackerCallbackExports<Collection>>: StructTypeInfo<
+        ModulesContract::Parametric::TrackerSession::TrackerCallbackExports<Collection>,
+        StructMember<&ModulesContract::Parametric::TrackerSession::TrackerCallbackExports<Collection>::moved>,
+        StructMember<&ModulesContract::Parametric::TrackerSession::TrackerCallbackExports<Collection>::_close>
+    > {};
+}
+
+extern template struct ModulesContract::Parametric::Point<rpc::Many>;
+extern template struct rpc::TypeInfo<ModulesContract::Parametric::Point<rpc::Many>>;
+extern template struct ModulesContract::Parametric::TrackerSession::TrackerCallExports<rpc::Many>;
+extern template struct rpc::TypeInfo<ModulesContract::Parametric::TrackerSession::TrackerCallExports<rpc::Many>>;
+extern template struct ModulesContract::Parametric::TrackerSession::TrackerCallbackExports<rpc::Many>;
+extern template struct rpc::TypeInfo<ModulesContract::Parametric::TrackerSession::TrackerCallbackExports<rpc::Many>>;
+
+struct ModulesContract::Types
+{
+    using Point = ModulesContract::Parametric::Point<rpc::Many>;
+    using LocateFunction = ModulesContract::Parametric::LocateFunction<rpc::Many>;
+
+    struct TrackerSession
+    {
+        using TrackerCallExports = ModulesContract::Parametric::TrackerSession::TrackerCallExports<rpc::Many>;
+        using TrackerCallbackExports = ModulesContract::Parametric::TrackerSession::TrackerCallbackExports<rpc::Many>;
+        using TrackAccept = ModulesContract::Parametric::TrackerSession::TrackAccept<rpc::Many>;
+        using TrackCreate = ModulesContract::Parametric::TrackerSession::TrackCreate<rpc::Many>;
+        using MovedCallback = ModulesContract::Parametric::TrackerSession::MovedCallback<rpc::Many>;
+    };
+};
+
+struct ModulesContract::Symbols
+{
+    static constexpr inline auto symLocate = rpc::symbol(ModulesContract::Types::LocateFunction(), "locate"_ctstr);
+
+    struct TrackerSession
+    {
+        static constexpr inline auto symTrack = rpc::symbol(ModulesContract::Types::TrackerSession::TrackCreate(), "track"_ctstr);
+    };
+};
+
@@ -0,0 +1,120 @@
+#ifndef _PACKED_H_
+#define _PACKED_H_
+
+#include <cstddef>
+
+#include "base/Call.h"
+#include "base/Symbol.h"
+
+#include "types/Collection.h"
+#include "types/StructTypeInfo.h"
+
+#include "framework/Session.h"
+
+struct PackedContract
+{
+    class Parametric;
+    class Types;
+    class Symbols;
+};
+
+/* Fixed size aggregates laid out like on the wire */
+struct PackedContract::Parametric
+{
+    template<template<class> class Collection> struct [[gnu::packed]] Point
+    {
+        int32_t x;
+        uint16_t y;
+        bool visible;
+        uint64_t stamp;
+    };
+
+    template<template<class> class Collection> struct [[gnu::packed]] Segment
+    {
+        Point<Collection> from;
+        Point<Collection> to;
+    };
+
+    template<template<class> class Collection> struct Label
+    {
+        Collection<int8_t> text;
+        Point<Collection> at;
+    };
+
+    template<template<class> class Collection> struct Empty {};
+
+    template<template<class> class Collection> struct Tagged
+    {
+        Empty<Collection> tag;
+        Point<Collection> at;
+    };
+
+    template<template<class> class Collection> using MoveCallback = rpc::Call</* retval */ Point<Collection>>;
+    template<template<class> class Collection> using MoveFunction = rpc::Call
+    <
+        /* s        */ Segment<Collection>,
+        /* l        */ Label<Collection>,
+        /* callback */ MoveCallback<Collection>
+    >;
+};
+
+namespace rpc
+{
+    template<template<class> class Collection> struct TypeInfo<PackedContract::Parametric::Point<Collection>>: TrivialStructTypeInfo<
+        PackedContract::Parametric::Point<Collection>,
+        StructMember<&PackedContract::Parametric::Point<Collection>::x>,
+        StructMember<&PackedContract::Parametric::Point<Collection>::y>,
+        StructMember<&PackedContract::Parametric::Point<Collection>::visible>,
+        StructMember<&PackedContract::Parametric::Point<Collection>::stamp>
+    > {
+        static_assert(sizeof(PackedContract::Parametric::Point<Collection>) == 15, "PackedContract::Parametric::Point must be 15 bytes long like on the wire");
+        static_assert(offsetof(PackedContract::Parametric::Point<Collection>, x) == 0, "PackedContract::Parametric::Point::x must be at offset 0 like on the wire");
+        static_assert(offsetof(PackedContract::Parametric::Point<Collection>, y) == 4, "PackedContract::Parametric::Point::y must be at offset 4 like on the wire");
+        static_assert(offsetof(PackedContract::Parametric::Point<Collection>, visible) == 6, "PackedContract::Parametric::Point::visible must be at offset 6 like on the wire");
+        static_assert(offsetof(PackedContract::Parametric::Point<Collection>, stamp) == 7, "PackedContract::Parametric::Point::stamp must be at offset 7 like on the wire");
+    };
+
+    template<template<class> class Collection> struct TypeInfo<PackedContract::Parametric::Segment<Collection>>: TrivialStructTypeInfo<
+        PackedContract::Parametric::Segment<Collection>,
+        StructMember<&PackedContract::Parametric::Segment<Collection>::from>,
+        StructMember<&PackedContract::Parametric::Segment<Collection>::to>
+    > {
+        static_assert(sizeof(PackedContract::Parametric::Segment<Collection>) == 30, "PackedContract::Parametric::Segment must be 30 bytes long like on the wire");
+        static_assert(offsetof(PackedContract::Parametric::Segment<Collection>, from) == 0, "PackedContract::Parametric::Segment::from must be at offset 0 like on the wire");
+        static_assert(offsetof(PackedContract::Parametric::Segment<Collection>, to) == 15, "PackedContract::Parametric::Segment::to must be at offset 15 like on the wire");
+    };
+
+    template<template<class> class Collection> struct TypeInfo<PackedContract::Parametric::Label<Collection>>: StructTypeInfo<
+        PackedContract::Parametric::Label<Collection>,
+        StructMember<&PackedContract::Parametric::Label<Collection>::text>,
+        StructMember<&PackedContract::Parametric::Label<Collection>::at>
+    > {};
+
+    template<template<class> class Collection> struct TypeInfo<PackedContract::Parametric::Empty<Collection>>: StructTypeInfo<
+        PackedContract::Parametric::Empty<Collection>
+    > {};
+
+    template<template<class> class Collection> struct TypeInfo<PackedContract::Parametric::Tagged<Collection>>: StructTypeInfo<
+        PackedContract::Parametric::Tagged<Collection>,
+        StructMember<&PackedContract::Parametric::Tagged<Collection>::tag>,
+        StructMember<&PackedContract::Parametric::Tagged<Collection>::at>
+    > {};
+}
+
+struct PackedContract::Types
+{
+    using Point = PackedContract::Parametric::Point<rpc::Many>;
+    using Segment = PackedContract::Parametric::Segment<rpc::Many>;
+    using Label = PackedContract::Parametric::Label<rpc::Many>;
+    using Empty = PackedContract::Parametric::Empty<rpc::Many>;
+    using Tagged = PackedContract::Parametric::Tagged<rpc::Many>;
+    using MoveFunction = PackedContract::Parametric::MoveFunction<rpc::Many>;
+};
+
+struct PackedContract::Symbols
+{
+    static constexpr inline auto symMove = rpc::symbol(PackedContract::Types::MoveFunction(), "move"_ctstr);
+};
+
+
+#endif /* _PACKED_H_ */
@@ -0,0 +1,75 @@
+#ifndef _REORDER_H_
+#define _REORDER_H_
+
+#include "base/Call.h"
+#include "base/Symbol.h"
+
+#include "types/Collection.h"
+#include "types/StructTypeInfo.h"
+
+#include "framework/Session.h"
+
+struct ReorderContract
+{
+    class Parametric;
+    class Types;
+    class Symbols;
+};
+
+/* Aggregates with reordered members */
+struct ReorderContract::Parametric
+{
+    template<template<class> class Collection> struct Mixed
+    {
+        uint64_t stamp;
+        uint32_t count;
+        uint16_t code;
+        bool flag;
+        bool ok;
+    };
+
+    template<template<class> class Collection> struct Nested
+    {
+        Mixed<Collection> mixed;
+        Collection<uint16_t> tail;
+        int32_t id;
+        uint8_t small;
+    };
+
+    template<template<class> class Collection> using SubmitCall = rpc::Call</* n */ Nested<Collection>>;
+};
+
+namespace rpc
+{
+    template<template<class> class Collection> struct TypeInfo<ReorderContract::Parametric::Mixed<Collection>>: StructTypeInfo<
+        ReorderContract::Parametric::Mixed<Collection>,
+        StructMember<&ReorderContract::Parametric::Mixed<Collection>::flag>,
+        StructMember<&ReorderContract::Parametric::Mixed<Collection>::stamp>,
+        StructMember<&ReorderContract::Parametric::Mixed<Collection>::code>,
+        StructMember<&ReorderContract::Parametric::Mixed<Collection>::ok>,
+        StructMember<&ReorderContract::Parametric::Mixed<Collection>::count>
+    > {};
+
+    template<template<class> class Collection> struct TypeInfo<ReorderContract::Parametric::Nested<Collection>>: StructTypeInfo<
+        ReorderContract::Parametric::Nested<Collection>,
+        StructMember<&ReorderContract::Parametric::Nested<Collection>::small>,
+        StructMember<&ReorderContract::Parametric::Nested<Collection>::mixed>,
+        StructMember<&ReorderContract::Parametric::Nested<Collection>::tail>,
+        StructMember<&ReorderContract::Parametric::Nested<Collection>::id>
+    > {};
+}
+
+struct ReorderContract::Types
+{
+    using Mixed = ReorderContract::Parametric::Mixed<rpc::Many>;
+    using Nested = ReorderContract::Parametric::Nested<rpc::Many>;
+    using SubmitCall = ReorderContract::Parametric::SubmitCall<rpc::Many>;
+};
+
+struct ReorderContract::Symbols
+{
+    static constexpr inline auto symSubmit = rpc::symbol(ReorderContract::Types::SubmitCall(), "submit"_ctstr);
+};
+
+
+#endif /* _REORDER_H_ */
@@ -0,0 +1,452 @@
+#ifndef _STRINGS_H_
+#define _STRINGS_H_
+
+#include <type_traits>
+
+#include "base/Call.h"
+#include "base/Symbol.h"
+
+#include "types/Collection.h"
+#include "types/Array.h"
+#include "types/String.h"
+#include "types/StructTypeInfo.h"
+#include "types/WireRecord.h"
+#include "types/WireBuilder.h"
+
+#include "framework/Session.h"
+
+struct StringsContract
+{
+    class Parametric;
+    class Types;
+    class Symbols;
+    class Views;
+    class WireSizes;
+    class Accessors;
+    class Builders;
+};
+
+/* Strings */
+struct StringsContract::Parametric
+{
+    template<template<class> class Collection> using Text = rpc::String<Collection>;
+
+    template<template<class> class Collection> struct Person
+    {
+        Text<Collection> name;
+        Collection<rpc::String<Collection>> nicknames;
+        std::array<rpc::String<Collection>, 2> initials;
+        uint8_t age;
+    };
+
+    template<template<class> class Collection> using GreetCallback = rpc::Call</* retval */ rpc::String<Collection>>;
+    template<template<class> class Collection> using GreetFunction = rpc::Call
+    <
+        /* who      */ Person<Collection>,
+        /* greeting */ rpc::String<Collection>,
+        /* callback */ GreetCallback<Collection>
+    >;
+
+    struct ChatSession
+    {
+        template<template<class> class Collection> using SayCall = rpc::Call</* line */ rpc::String<Collection>>;
+
+        template<template<class> class Collection> using HeardCallback = rpc::Call
+        <
+            /* from */ Text<Collection>,
+            /* line */ rpc::String<Collection>
+        >;
+
+        template<template<class> class Collection> struct ChatCallExports
+        {
+            SayCall<Collection> say;
+            rpc::Call<> _close;
+        };
+
+        template<template<class> class Collection> struct ChatCallbackExports
+        {
+            HeardCallback<Collection> heard;
+            rpc::Call<> _close;
+        };
+
+        template<template<class> class Collection> using JoinAccept = rpc::Call
+        <
+            /* _retval  */ Text<Collection>,
+            /* _exports */ ChatCallExports<Collection>
+        >;
+        template<template<class> class Collection> using JoinCreate = rpc::Call
+        <
+            /* nick     */ rpc::String<Collection>,
+            /* _exports */ ChatCallbackExports<Collection>,
+            /* _accept  */ JoinAccept<Collection>
+        >;
+    };
+};
+
+namespace rpc
+{
+    template<template<class> class Collection> struct TypeInfo<StringsContract::Parametric::Person<Collection>>: StructTypeInfo<
+        StringsContract::Parametric::Person<Collection>,
+        StructMember<&StringsContract::Parametric::Person<Collection>::name>,
+        StructMember<&StringsContract::Parametric::Person<Collection>::nicknames>,
+        StructMember<&StringsContract::Parametric::Person<Collection>::initials>,
+        StructMember<&StringsContract::Parametric::Person<Collection>::age>
+    > {};
+
+    template<template<class> class Collection> struct TypeInfo<StringsContract::Parametric::ChatSession::ChatCallExports<Collection>>: StructTypeInfo<
+        StringsContract::Parametric::ChatSession::ChatCallExports<Collection>,
+        StructMember<&StringsContract::Parametric::ChatSession::ChatCallExports<Collection>::say>,
+        StructMember<&StringsContract::Parametric::ChatSession::ChatCallExports<Collection>::_close>
+    > {};
+
+    template<template<class> class Collection> struct TypeInfo<StringsContract::Parametric::ChatSession::ChatCallbackExports<Collection>>: StructTypeInfo<
+        StringsContract::Parametric::ChatSession::ChatCallbackExports<Collection>,
+        StructMember<&StringsContract::Parametric::ChatSession::ChatCallbackExports<Collection>::heard>,
+        StructMember<&StringsContract::Parametric::ChatSession::ChatCallbackExports<Collection>::_close>
+    > {};
+}
+
+struct StringsContract::Types
+{
+    using Text = StringsContract::Parametric::Text<rpc::Many>;
+    using Person = StringsContract::Parametric::Person<rpc::Many>;
+    using GreetFunction = StringsContract::Parametric::GreetFunction<rpc::Many>;
+
+    struct ChatSession
+    {
+        using ChatCallExports = StringsContract::Parametric::ChatSession::ChatCallExports<rpc::Many>;
+        using ChatCallbackExports = StringsContract::Parametric::ChatSession::ChatCallbackExports<rpc::Many>;
+        using JoinAccept = StringsContract::Parametric::ChatSession::JoinAccept<rpc::Many>;
+        using JoinCreate = StringsContract::Parametric::ChatSession::JoinCreate<rpc::Many>;
+        using SayCall = StringsContract::Parametric::ChatSession::SayCall<rpc::Many>;
+        using HeardCallback = StringsContract::Parametric::ChatSession::HeardCallback<rpc::Many>;
+    };
+};
+
+struct StringsContract::Views
+{
+    using Text = StringsContract::Parametric::Text<rpc::View>;
+    using Person = StringsContract::Parametric::Person<rpc::View>;
+    using GreetFunction = StringsContract::Parametric::GreetFunction<rpc::View>;
+
+    struct ChatSession
+    {
+        using ChatCallExports = StringsContract::Parametric::ChatSession::ChatCallExports<rpc::View>;
+        using ChatCallbackExports = StringsContract::Parametric::ChatSession::ChatCallbackExports<rpc::View>;
+        using JoinAccept = StringsContract::Parametric::ChatSession::JoinAccept<rpc::View>;
+        using JoinCreate = StringsContract::Parametric::ChatSession::JoinCreate<rpc::View>;
+        using SayCall = StringsContract::Parametric::ChatSession::SayCall<rpc::View>;
+        using HeardCallback = StringsContract::Parametric::ChatSession::HeardCallback<rpc::View>;
+    };
+};
+
+struct StringsContract::WireSizes
+{
+    template<class T>
+    static constexpr std::enable_if_t<std::is_arithmetic_v<T>, size_t> sizeOf(const T&)
+    {
+        return sizeof(T);
+    }
+
+    template<class C>
+    static inline auto sizeOf(const C& c) -> decltype(c.size(), size_t{})
+    {
+        auto ret = rpc::collectionHeaderSize(c.size());
+
+        for(const auto& e: c)
+        {
+            ret += sizeOf(e);
+        }
+
+        return ret;
+    }
+
+    template<class T, size_t N>
+    static inline size_t sizeOf(const std::array<T, N>& a)
+    {
+        size_t ret = 0;
+
+        for(const auto& e: a)
+        {
+            ret += sizeOf(e);
+        }
+
+        return ret;
+    }
+
+    template<class C, class T, class A>
+    static inline size_t sizeOf(const std::basic_string<C, T, A>& s)
+    {
+        return rpc::collectionHeaderSize(s.size()) + s.size() * sizeof(C);
+    }
+
+    template<class C, class T>
+    static inline size_t sizeOf(const std::basic_string_view<C, T>& s)
+    {
+        return rpc::collectionHeaderSize(s.size()) + s.size() * sizeof(C);
+    }
+
+    template<template<class> class Collection>
+    static inline size_t sizeOf(const StringsContract::Parametric::Person<Collection>& v)
+    {
+        return 1 + sizeOf(v.name) + sizeOf(v.nicknames) + sizeOf(v.initials);
+    }
+
+    template<class A0>
+    static inline size_t GreetCallback(const A0& retval)
+    {
+        return rpc::collectionHeaderSize(retval.size()) + retval.size();
+    }
+
+    template<class A0, class A1>
+    static inline size_t GreetFunction(const A0& who, const A1& greeting)
+    {
+        return rpc::callWireSize + sizeOf(who) + rpc::collectionHeaderSize(greeting.size()) + greeting.size();
+    }
+
+    struct ChatSession
+    {
+        template<class A0>
+        static inline size_t SayCall(const A0& line)
+        {
+            return rpc::collectionHeaderSize(line.size()) + line.size();
+        }
+
+        template<class A0, class A1>
+        static inline size_t HeardCallback(const A0& from, const A1& line)
+        {
+            return sizeOf(from) + rpc::collectionHeaderSize(line.size()) + line.size();
+        }
+
+        static constexpr size_t ChatCallExports = 2 * rpc::callWireSize;
+        static constexpr size_t ChatCallbackExports = 2 * rpc::callWireSize;
+
+        template<class A0>
+        static inline size_t JoinAccept(const A0& _retval)
+        {
+            return 2 * rpc::callWireSize + sizeOf(_retval);
+        }
+
+        template<class A0>
+        static inline size_t JoinCreate(const A0& nick)
+        {
+            return 3 * rpc::callWireSize + rpc::collectionHeaderSize(nick.size()) + nick.size();
+        }
+    };
+};
+
+struct StringsContract::Accessors
+{
+    using Text = std::string_view;
+
+    struct Person: rpc::WireRecord<Text, rpc::WireMany<std::string_view>, rpc::WireArray<std::string_view, 2>, uint8_t>
+    {
+        using WireRecord::WireRecord;
+        inline auto name() const { return this->template field<0, 0>(); }
+        inline auto nicknames() const { return this->template field<1>(); }
+        inline auto initials() const { return this->template field<2>(); }
+        inline auto age() const { return this->template field<3>(); }
+    };
+
+    struct GreetCallback: rpc::WireRecord<std::string_view>
+    {
+        using WireRecord::WireRecord;
+        inline auto retval() const { return this->template field<0, 0>(); }
+    };
+
+    struct GreetFunction: rpc::WireRecord<Person, std::string_view, rpc::WireCall>
+    {
+        using WireRecord::WireRecord;
+        inline auto who() const { return this->template field<0, 0>(); }
+        inline auto greeting() const { return this->template field<1>(); }
+        inline auto callback() const { return this->template field<2>(); }
+    };
+
+    struct ChatSession
+    {
+        struct SayCall: rpc::WireRecord<std::string_view>
+        {
+            using WireRecord::WireRecord;
+            inline auto line() const { return this->template field<0, 0>(); }
+        };
+
+        struct HeardCallback: rpc::WireRecord<Text, std::string_view>
+        {
+            using WireRecord::WireRecord;
+            inline auto from() const { return this->template field<0, 0>(); }
+            inline auto line() const { return this->template field<1>(); }
+        };
+
+        struct JoinAccept: rpc::WireRecord<Text, rpc::WireCalls<2>>
+        {
+            using WireRecord::WireRecord;
+            inline auto _retval() const { return this->template field<0, 0>(); }
+            inline auto _exports() const { return this->template field<1>(); }
+        };
+
+        struct JoinCreate: rpc::WireRecord<std::string_view, rpc::WireCalls<2>, rpc::WireCall>
+        {
+            using WireRecord::WireRecord;
+            inline auto nick() const { return this->template field<0, 0>(); }
+            inline auto _exports() const { return this->template field<1>(); }
+            inline auto _accept() const { return this->template field<2>(); }
+        };
+    };
+};
+
+struct StringsContract::Builders
+{
+    template<class Out, size_t I = 0> struct Person: rpc::WireBuilder<Out>
+    {
+        using Person::WireBuilder::WireBuilder;
+        static constexpr size_t fieldCount = 4;
+
+        inline auto name(std::string_view v) &&
+        {
+            static_assert(I == 0, "Fields of Person must be written in wire order");
+            return this->template put<Person<Out, 1>>(v);
+        }
+
+        inline auto nicknames(size_t n) &&
+        {
+            static_assert(I == 1, "Fields of Person must be written in wire order");
+            return this->template reserve<Person<Out, 2>, std::string_view>(n);
+        }
+
+        inline auto initials(const std::array<std::string_view, 2>& v) &&
+        {
+            static_assert(I == 2, "Fields of Person must be written in wire order");
+            return this->template put<Person<Out, 3>>(v);
+        }
+
+        inline auto age(uint8_t v) &&
+        {
+            static_assert(I == 3, "Fields of Person must be written in wire order");
+            return this->template put<Person<Out, 4>>(v);
+        }
+    };
+
+    template<class Out, size_t I = 0> struct GreetCallback: rpc::WireBuilder<Out>
+    {
+        using GreetCallback::WireBuilder::WireBuilder;
+        static constexpr size_t fieldCount = 1;
+
+        inline auto retval(std::string_view v) &&
+        {
+            static_assert(I == 0, "Fields of GreetCallback must be written in wire order");
+            return this->template put<GreetCallback<Out, 1>>(v);
+        }
+    };
+
+    template<class Out, size_t I = 0> struct GreetFunction: rpc::WireBuilder<Out>
+    {
+        using GreetFunction::WireBuilder::WireBuilder;
+        static constexpr size_t fieldCount = 3;
+
+        inline auto who() &&
+        {
+            static_assert(I == 0, "Fields of GreetFunction must be written in wire order");
+            return this->template nest<GreetFunction<Out, 1>, Person<Out>>();
+        }
+
+        inline auto greeting(std::string_view v) &&
+        {
+            static_assert(I == 1, "Fields of GreetFunction must be written in wire order");
+            return this->template put<GreetFunction<Out, 2>>(v);
+        }
+
+        inline auto callback(const StringsContract::Parametric::GreetCallback<rpc::Many>& v) &&
+        {
+            static_assert(I == 2, "Fields of GreetFunction must be written in wire order");
+            return this->template put<GreetFunction<Out, 3>>(v);
+        }
+    };
+
+    struct ChatSession
+    {
+        template<class Out, size_t I = 0> struct SayCall: rpc::WireBuilder<Out>
+        {
+            using SayCall::WireBuilder::WireBuilder;
+            static constexpr size_t fieldCount = 1;
+
+            inline auto line(std::string_view v) &&
+            {
+                static_assert(I == 0, "Fields of SayCall must be written in wire order");
+                return this->template put<SayCall<Out, 1>>(v);
+            }
+        };
+
+        template<class Out, size_t I = 0> struct HeardCallback: rpc::WireBuilder<Out>
+        {
+            using HeardCallback::WireBuilder::WireBuilder;
+            static constexpr size_t fieldCount = 2;
+
+            inline auto from(std::string_view v) &&
+            {
+                static_assert(I == 0, "Fields of HeardCallback must be written in wire order");
+                return this->template put<HeardCallback<Out, 1>>(v);
+            }
+
+            inline auto line(std::string_view v) &&
+            {
+                static_assert(I == 1, "Fields of HeardCallback must be written in wire order");
+                return this->template put<HeardCallback<Out, 2>>(v);
+            }
+        };
+
+        template<class Out, size_t I = 0> struct JoinAccept: rpc::WireBuilder<Out>
+        {
+            using JoinAccept::WireBuilder::WireBuilder;
+            static constexpr size_t fieldCount = 2;
+
+            inline auto _retval(std::string_view v) &&
+            {
+                static_assert(I == 0, "Fields of JoinAccept must be written in wire order");
+                return this->template put<JoinAccept<Out, 1>>(v);
+            }
+
+            inline auto _exports(const StringsContract::Parametric::ChatSession::ChatCallExports<rpc::Many>& v) &&
+            {
+                static_assert(I == 1, "Fields of JoinAccept must be written in wire order");
+                return this->template put<JoinAccept<Out, 2>>(v);
+            }
+        };
+
+        template<class Out, size_t I = 0> struct JoinCreate: rpc::WireBuilder<Out>
+        {
+            using JoinCreate::WireBuilder::WireBuilder;
+            static constexpr size_t fieldCount = 3;
+
+            inline auto nick(std::string_view v) &&
+            {
+                static_assert(I == 0, "Fields of JoinCreate must be written in wire order");
+                return this->template put<JoinCreate<Out, 1>>(v);
+            }
+
+            inline auto _exports(const StringsContract::Parametric::ChatSession::ChatCallbackExports<rpc::Many>& v) &&
+            {
+                static_assert(I == 1, "Fields of JoinCreate must be written in wire order");
+                return this->template put<JoinCreate<Out, 2>>(v);
+            }
+
+            inline auto _accept(const StringsContract::Parametric::ChatSession::JoinAccept<rpc::Many>& v) &&
+            {
+                static_assert(I == 2, "Fields of JoinCreate must be written in wire order");
+                return this->template put<JoinCreate<Out, 3>>(v);
+            }
+        };
+    };
+};
+
+struct StringsContract::Symbols
+{
+    static constexpr inline auto symGreet = rpc::symbol(StringsContract::Types::GreetFunction(), "greet"_ctstr);
+
+    struct ChatSession
+    {
+        static constexpr inline auto symJoin = rpc::symbol(StringsContract::Types::ChatSession::JoinCreate(), "join"_ctstr);
+    };
+};
+
+
+#endif /* _STRINGS_H_ */
@@ -0,0 +1,270 @@
+#ifndef _UNROLLED_H_
+#define _UNROLLED_H_
+
+#include "base/Call.h"
+#include "base/Symbol.h"
+
+#include "types/Collection.h"
+#include "types/StructTypeInfo.h"
+
+#include "framework/Session.h"
+
+struct UnrolledContract
+{
+    class Parametric;
+    class Types;
+    class Symbols;
+};
+
+/* Serializers unrolled by the generator */
+struct UnrolledContract::Parametric
+{
+    template<template<class> class Collection> struct Sample
+    {
+        int16_t value;
+        bool valid;
+    };
+
+    template<template<class> class Collection> struct Series
+    {
+        Sample<Collection> first;
+        Collection<Sample<Collection>> rest;
+        Collection<uint8_t> name;
+    };
+
+    template<template<class> class Collection> struct Nothing {};
+
+    template<template<class> class Collection> struct Wrapped
+    {
+        Nothing<Collection> none;
+        uint16_t count;
+    };
+
+    template<template<class> class Collection> using RecordCallback = rpc::Call</* retval */ Sample<Collection>>;
+    template<template<class> class Collection> using RecordFunction = rpc::Call
+    <
+        /* s        */ Series<Collection>,
+        /* callback */ RecordCallback<Collection>
+    >;
+
+    struct StreamSession
+    {
+        template<template<class> class Collection> using PushCall = rpc::Call</* s */ Sample<Collection>>;
+        template<template<class> class Collection> using PushedCallback = rpc::Call</* count */ uint32_t>;
+
+        template<template<class> class Collection> struct StreamCallExports
+        {
+            PushCall<Collection> push;
+            rpc::Call<> _close;
+        };
+
+        template<template<class> class Collection> struct StreamCallbackExports
+        {
+            PushedCallback<Collection> pushed;
+            rpc::Call<> _close;
+        };
+
+        template<template<class> class Collection> using OpenAccept = rpc::Call
+        <
+            /* _retval  */ uint32_t,
+            /* _exports */ StreamCallExports<Collection>
+        >;
+        template<template<class> class Collection> using OpenCreate = rpc::Call
+        <
+            /* from     */ Sample<Collection>,
+            /* _exports */ StreamCallbackExports<Collection>,
+            /* _accept  */ OpenAccept<Collection>
+        >;
+    };
+};
+
+namespace rpc
+{
+    template<template<class> class Collection> struct TypeInfo<UnrolledContract::Parametric::Sample<Collection>>
+    {
+        static constexpr auto sgn = structSignature(TypeInfo<decltype(UnrolledContract::Parametric::Sample<Collection>::value)>::sgn, TypeInfo<decltype(UnrolledContract::Parametric::Sample<Collection>::valid)>::sgn);
+        static constexpr bool isFixedSize = true;
+
+        static constexpr inline size_t size(const UnrolledContract::Parametric::Sample<Collection>& v)
+        {
+            return TypeInfo<decltype(UnrolledContract::Parametric::Sample<Collection>::value)>::size(v.value)
+                + TypeInfo<decltype(UnrolledContract::Parametric::Sample<Collection>::valid)>::size(v.valid);
+        }
+
+        template<class S>
+        static inline bool write(S& s, const UnrolledContract::Parametric::Sample<Collection>& v)
+        {
+            return TypeInfo<decltype(UnrolledContract::Parametric::Sample<Collection>::value)>::write(s, v.value)
+                && TypeInfo<decltype(UnrolledContract::Parametric::Sample<Collection>::valid)>::write(s, v.valid);
+        }
+
+        template<class S>
+        static inline bool read(S& s, UnrolledContract::Parametric::Sample<Collection>& v)
+        {
+            return TypeInfo<decltype(UnrolledContract::Parametric::Sample<Collection>::value)>::read(s, v.value)
+                && TypeInfo<decltype(UnrolledContract::Parametric::Sample<Collection>::valid)>::read(s, v.valid);
+        }
+    };
+
+    template<template<class> class Collection> struct TypeInfo<UnrolledContract::Parametric::Series<Collection>>
+    {
+        static constexpr auto sgn = structSignature(TypeInfo<decltype(UnrolledContract::Parametric::Series<Collection>::first)>::sgn, TypeInfo<decltype(UnrolledContract::Parametric::Series<Collection>::rest)>::sgn, TypeInfo<decltype(UnrolledContract::Parametric::Series<Collection>::name)>::sgn);
+        static constexpr bool isFixedSize = false;
+
+        static constexpr inline size_t size(const UnrolledContract::Parametric::Series<Collection>& v)
+        {
+            return TypeInfo<decltype(UnrolledContract::Parametric::Series<Collection>::first)>::size(v.first)
+                + TypeInfo<decltype(UnrolledContract::Parametric::Series<Collection>::rest)>::size(v.rest)
+                + TypeInfo<decltype(UnrolledContract::Parametric::Series<Collection>::name)>::size(v.name);
+        }
+
+        template<class S>
+        static inline bool write(S& s, const UnrolledContract::Parametric::Series<Collection>& v)
+        {
+            return TypeInfo<decltype(UnrolledContract::Parametric::Series<Collection>::first)>::write(s, v.first)
+                && TypeInfo<decltype(UnrolledContract::Parametric::Series<Collection>::rest)>::write(s, v.rest)
+                && TypeInfo<decltype(UnrolledContract::Parametric::Series<Collection>::name)>::write(s, v.name);
+        }
+
+        template<class S>
+        static inline bool read(S& s, UnrolledContract::Parametric::Series<Collection>& v)
+        {
+            return TypeInfo<decltype(UnrolledContract::Parametric::Series<Collection>::first)>::read(s, v.first)
+                && TypeInfo<decltype(UnrolledContract::Parametric::Series<Collection>::rest)>::read(s, v.rest)
+                && TypeInfo<decltype(UnrolledContract::Parametric::Series<Collection>::name)>::read(s, v.name);
+        }
+    };
+
+    template<template<class> class Collection> struct TypeInfo<UnrolledContract::Parametric::Nothing<Collection>>
+    {
+        static constexpr auto sgn = structSignature();
+        static constexpr bool isFixedSize = true;
+
+        static constexpr inline size_t size(const UnrolledContract::Parametric::Nothing<Collection>& v)
+        {
+            return 0;
+        }
+
+        template<class S>
+        static inline bool write(S& s, const UnrolledContract::Parametric::Nothing<Collection>& v)
+        {
+            return true;
+        }
+
+        template<class S>
+        static inline bool read(S& s, UnrolledContract::Parametric::Nothing<Collection>& v)
+        {
+            return true;
+        }
+    };
+
+    template<template<class> class Collection> struct TypeInfo<UnrolledContract::Parametric::Wrapped<Collection>>
+    {
+        static constexpr auto sgn = structSignature(TypeInfo<decltype(UnrolledContract::Parametric::Wrapped<Collection>::none)>::sgn, TypeInfo<decltype(UnrolledContract::Parametric::Wrapped<Collection>::count)>::sgn);
+        static constexpr bool isFixedSize = true;
+
+        static constexpr inline size_t size(const UnrolledContract::Parametric::Wrapped<Collection>& v)
+        {
+            return TypeInfo<decltype(UnrolledContract::Parametric::Wrapped<Collection>::none)>::size(v.none)
+                + TypeInfo<decltype(UnrolledContract::Parametric::Wrapped<Collection>::count)>::size(v.count);
+        }
+
+        template<class S>
+        static inline bool write(S& s, const UnrolledContract::Parametric::Wrapped<Collection>& v)
+        {
+            return TypeInfo<decltype(UnrolledContract::Parametric::Wrapped<Collection>::none)>::write(s, v.none)
+                && TypeInfo<decltype(UnrolledContract::Parametric::Wrapped<Collection>::count)>::write(s, v.count);
+        }
+
+        template<class S>
+        static inline bool read(S& s, UnrolledContract::Parametric::Wrapped<Collection>& v)
+        {
+            return TypeInfo<decltype(UnrolledContract::Parametric::Wrapped<Collection>::none)>::read(s, v.none)
+                && TypeInfo<decltype(UnrolledContract::Parametric::Wrapped<Collection>::count)>::read(s, v.count);
+        }
+    };
+
+    template<template<class> class Collection> struct TypeInfo<UnrolledContract::Parametric::StreamSession::StreamCallExports<Collection>>
+    {
+        static constexpr auto sgn = structSignature(TypeInfo<decltype(UnrolledContract::Parametric::StreamSession::StreamCallExports<Collection>::push)>::sgn, TypeInfo<decltype(UnrolledContract::Parametric::StreamSession::StreamCallExports<Collection>::_close)>::sgn);
+        static constexpr bool isFixedSize = true;
+
+        static constexpr inline size_t size(const UnrolledContract::Parametric::StreamSession::StreamCallExports<Collection>& v)
+        {
+            return TypeInfo<decltype(UnrolledContract::Parametric::StreamSession::StreamCallExports<Collection>::push)>::size(v.push)
+                + TypeInfo<decltype(UnrolledContract::Parametric::StreamSession::StreamCallExports<Collection>::_close)>::size(v._close);
+        }
+
+        template<class S>
+        static inline bool write(S& s, const UnrolledContract::Parametric::StreamSession::StreamCallExports<Collection>& v)
+        {
+            return TypeInfo<decltype(UnrolledContract::Parametric::StreamSession::StreamCallExports<Collection>::push)>::write(s, v.push)
+                && TypeInfo<decltype(UnrolledContract::Parametric::StreamSession::StreamCallExports<Collection>::_close)>::write(s, v._close);
+        }
+
+        template<class S>
+        static inline bool read(S& s, UnrolledContract::Parametric::StreamSession::StreamCallExports<Collection>& v)
+        {
+            return TypeInfo<decltype(UnrolledContract::Parametric::StreamSession::StreamCallExports<Collection>::push)>::read(s, v.push)
+                && TypeInfo<decltype(UnrolledContract::Parametric::StreamSession::StreamCallExports<Collection>::_close)>::read(s, v._close);
+        }
+    };
+
+    template<template<class> class Collection> struct TypeInfo<UnrolledContract::Parametric::StreamSession::StreamCallbackExports<Collection>>
+    {
+        static constexpr auto sgn = structSignature(TypeInfo<decltype(UnrolledContract::Parametric::StreamSession::StreamCallbackExports<Collection>::pushed)>::sgn, TypeInfo<decltype(UnrolledContract::Parametric::StreamSession::StreamCallbackExports<Collection>::_close)>::sgn);
+        static constexpr bool isFixedSize = true;
+
+        static constexpr inline size_t size(const UnrolledContract::Parametric::StreamSession::StreamCallbackExports<Collection>& v)
+        {
+            return TypeInfo<decltype(UnrolledContract::Parametric::StreamSession::StreamCallbackExports<Collection>::pushed)>::size(v.pushed)
+                + TypeInfo<decltype(UnrolledContract::Parametric::StreamSession::StreamCallbackExports<Collection>::_close)>::size(v._close);
+        }
+
+        template<class S>
+        static inline bool write(S& s, const UnrolledContract::Parametric::StreamSession::StreamCallbackExports<Collection>& v)
+        {
+            return TypeInfo<decltype(UnrolledContract::Parametric::StreamSession::StreamCallbackExports<Collection>::pushed)>::write(s, v.pushed)
+                && TypeInfo<decltype(UnrolledContract::Parametric::StreamSession::StreamCallbackExports<Collection>::_close)>::write(s, v._close);
+        }
+
+        template<class S>
+        static inline bool read(S& s, UnrolledContract::Parametric::StreamSession::StreamCallbackExports<Collection>& v)
+        {
+            return TypeInfo<decltype(UnrolledContract::Parametric::StreamSession::StreamCallbackExports<Collection>::pushed)>::read(s, v.pushed)
+                && TypeInfo<decltype(UnrolledContract::Parametric::StreamSession::StreamCallbackExports<Collection>::_close)>::read(s, v._close);
+        }
+    };
+}
+
+struct UnrolledContract::Types
+{
+    using Sample = UnrolledContract::Parametric::Sample<rpc::Many>;
+    using Series = UnrolledContract::Parametric::Series<rpc::Many>;
+    using Nothing = UnrolledContract::Parametric::Nothing<rpc::Many>;
+    using Wrapped = UnrolledContract::Parametric::Wrapped<rpc::Many>;
+    using RecordFunction = UnrolledContract::Parametric::RecordFunction<rpc::Many>;
+
+    struct StreamSession
+    {
+        using StreamCallExports = UnrolledContract::Parametric::StreamSession::StreamCallExports<rpc::Many>;
+        using StreamCallbackExports = UnrolledContract::Parametric::StreamSession::StreamCallbackExports<rpc::Many>;
+        using OpenAccept = UnrolledContract::Parametric::StreamSession::OpenAccept<rpc::Many>;
+        using OpenCreate = UnrolledContract::Parametric::StreamSession::OpenCreate<rpc::Many>;
+        using PushCall = UnrolledContract::Parametric::StreamSession::PushCall<rpc::Many>;
+        using PushedCallback = UnrolledContract::Parametric::StreamSession::PushedCallback<rpc::Many>;
+    };
+};
+
+struct UnrolledContract::Symbols
+{
+    static constexpr inline auto symRecord = rpc::symbol(UnrolledContract::Types::RecordFunction(), "record"_ctstr);
+
+    struct StreamSession
+    {
+        static constexpr inline auto symOpen = rpc::symbol(UnrolledContract::Types::StreamSession::OpenCreate(), "open"_ctstr);
+    };
+};
+
+
+#endif /* _UNROLLED_H_ */
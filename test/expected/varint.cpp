@@ -0,0 +1,8 @@
+#include "varint.h"
+
+template struct VarintContract::Parametric::Entry<rpc::Many>;
+template struct rpc::TypeInfo<VarintContract::Parametric::Entry<rpc::Many>>;
+template struct VarintContract::Parametric::CursorSession::CursorCallExports<rpc::Many>;
+template struct rpc::TypeInfo<VarintContract::Parametric::CursorSession::CursorCallExports<rpc::Many>>;
+template struct VarintContract::Parametric::CursorSession::CursorCallbackExports<rpc::Many>;
+template struct rpc::TypeInfo<VarintContract::Parametric::CursorSession::CursorCallbackExports<rpc::Many>>;
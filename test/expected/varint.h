@@ -0,0 +1,296 @@
+#ifndef _VARINT_H_
+#define _VARINT_H_
+
+#include <vector>
+
+#include "base/Call.h"
+#include "base/Symbol.h"
+
+#include "types/Collection.h"
+#include "types/StructTypeInfo.h"
+
+#include "framework/Session.h"
+
+struct VarintContract
+{
+    class Parametric;
+    class Types;
+    class Symbols;
+    class Columns;
+};
+
+/* Integers encoded by magnitude */
+struct VarintContract::Parametric
+{
+    template<template<class> class Collection> using Id = uint32_t;
+
+    template<template<class> class Collection> struct Entry
+    {
+        Id<Collection> id;
+        uint8_t small;
+        int64_t delta;
+        bool on;
+        bool off;
+    };
+
+    template<template<class> class Collection> using Ids = Collection<Id<Collection>>;
+
+    template<template<class> class Collection> using LookupCallback = rpc::Call</* retval */ rpc::Varint<int32_t>>;
+    template<template<class> class Collection> using LookupFunction = rpc::Call
+    <
+        /* id       */ rpc::Varint<Id<Collection>>,
+        /* ids      */ Ids<Collection>,
+        /* entries  */ Collection<Entry<Collection>>,
+        /* callback */ LookupCallback<Collection>
+    >;
+
+    struct CursorSession
+    {
+        template<template<class> class Collection> using SeekCall = rpc::Call</* to */ int16_t>;
+        template<template<class> class Collection> using AtCallback = rpc::Call</* position */ rpc::Varint<uint64_t>>;
+
+        template<template<class> class Collection> struct CursorCallExports
+        {
+            SeekCall<Collection> seek;
+            rpc::Call<> _close;
+        };
+
+        template<template<class> class Collection> struct CursorCallbackExports
+        {
+            AtCallback<Collection> at;
+            rpc::Call<> _close;
+        };
+
+        template<template<class> class Collection> using OpenAccept = rpc::Call
+        <
+            /* _retval  */ rpc::Varint<Id<Collection>>,
+            /* _exports */ CursorCallExports<Collection>
+        >;
+        template<template<class> class Collection> using OpenCreate = rpc::Call
+        <
+            /* from     */ rpc::Varint<uint64_t>,
+            /* _exports */ CursorCallbackExports<Collection>,
+            /* _accept  */ OpenAccept<Collection>
+        >;
+    };
+};
+
+namespace rpc
+{
+    template<template<class> class Collection> struct TypeInfo<VarintContract::Parametric::Entry<Collection>>
+    {
+        static constexpr auto sgn = structSignature(TypeInfo<rpc::Varint<decltype(VarintContract::Parametric::Entry<Collection>::id)>>::sgn, TypeInfo<decltype(VarintContract::Parametric::Entry<Collection>::small)>::sgn, TypeInfo<rpc::Varint<decltype(VarintContract::Parametric::Entry<Collection>::delta)>>::sgn, FlagsInfo<2>::sgn);
+        static constexpr bool isFixedSize = false;
+
+        static constexpr inline size_t size(const VarintContract::Parametric::Entry<Collection>& v)
+        {
+            return TypeInfo<rpc::Varint<decltype(VarintContract::Parametric::Entry<Collection>::id)>>::size(rpc::Varint<decltype(VarintContract::Parametric::Entry<Collection>::id)>::ref(v.id))
+                + TypeInfo<decltype(VarintContract::Parametric::Entry<Collection>::small)>::size(v.small)
+                + TypeInfo<rpc::Varint<decltype(VarintContract::Parametric::Entry<Collection>::delta)>>::size(rpc::Varint<decltype(VarintContract::Parametric::Entry<Collection>::delta)>::ref(v.delta))
+                + FlagsInfo<2>::size(v.on, v.off);
+        }
+
+        template<class S>
+        static inline bool write(S& s, const VarintContract::Parametric::Entry<Collection>& v)
+        {
+            return TypeInfo<rpc::Varint<decltype(VarintContract::Parametric::Entry<Collection>::id)>>::write(s, rpc::Varint<decltype(VarintContract::Parametric::Entry<Collection>::id)>::ref(v.id))
+                && TypeInfo<decltype(VarintContract::Parametric::Entry<Collection>::small)>::write(s, v.small)
+                && TypeInfo<rpc::Varint<decltype(VarintContract::Parametric::Entry<Collection>::delta)>>::write(s, rpc::Varint<decltype(VarintContract::Parametric::Entry<Collection>::delta)>::ref(v.delta))
+                && FlagsInfo<2>::write(s, v.on, v.off);
+        }
+
+        template<class S>
+        static inline bool read(S& s, VarintContract::Parametric::Entry<Collection>& v)
+        {
+            return TypeInfo<rpc::Varint<decltype(VarintContract::Parametric::Entry<Collection>::id)>>::read(s, rpc::Varint<decltype(VarintContract::Parametric::Entry<Collection>::id)>::ref(v.id))
+                && TypeInfo<decltype(VarintContract::Parametric::Entry<Collection>::small)>::read(s, v.small)
+                && TypeInfo<rpc::Varint<decltype(VarintContract::Parametric::Entry<Collection>::delta)>>::read(s, rpc::Varint<decltype(VarintContract::Parametric::Entry<Collection>::delta)>::ref(v.delta))
+                && FlagsInfo<2>::read(s, v.on, v.off);
+        }
+    };
+
+    template<template<class> class Collection> struct TypeInfo<VarintContract::Parametric::CursorSession::CursorCallExports<Collection>>
+    {
+        static constexpr auto sgn = structSignature(TypeInfo<decltype(VarintContract::Parametric::CursorSession::CursorCallExports<Collection>::seek)>::sgn, TypeInfo<decltype(VarintContract::Parametric::CursorSession::CursorCallExports<Collection>::_close)>::sgn);
+        static constexpr bool isFixedSize = true;
+
+        static constexpr inline size_t size(const VarintContract::Parametric::CursorSession::CursorCallExports<Collection>& v)
+        {
+            return TypeInfo<decltype(VarintContract::Parametric::CursorSession::CursorCallExports<Collection>::seek)>::size(v.seek)
+                + TypeInfo<decltype(VarintContract::Parametric::CursorSession::CursorCallExports<Collection>::_close)>::size(v._close);
+        }
+
+        template<class S>
+        static inline bool write(S& s, const VarintContract::Parametric::CursorSession::CursorCallExports<Collection>& v)
+        {
+            return TypeInfo<decltype(VarintContract::Parametric::CursorSession::CursorCallExports<Collection>::seek)>::write(s, v.seek)
+                && TypeInfo<decltype(VarintContract::Parametric::CursorSession::CursorCallExports<Collection>::_close)>::write(s, v._close);
+        }
+
+        template<class S>
+        static inline bool read(S& s, VarintContract::Parametric::CursorSession::CursorCallExports<Collection>& v)
+        {
+            return TypeInfo<decltype(VarintContract::Parametric::CursorSession::CursorCallExports<Collection>::seek)>::read(s, v.seek)
+                && TypeInfo<decltype(VarintContract::Parametric::CursorSession::CursorCallExports<Collection>::_close)>::read(s, v._close);
+        }
+    };
+
+    template<template<class> class Collection> struct TypeInfo<VarintContract::Parametric::CursorSession::CursorCallbackExports<Collection>>
+    {
+        static constexpr auto sgn = structSignature(TypeInfo<decltype(VarintContract::Parametric::CursorSession::CursorCallbackExports<Collection>::at)>::sgn, TypeInfo<decltype(VarintContract::Parametric::CursorSession::CursorCallbackExports<Collection>::_close)>::sgn);
+        static constexpr bool isFixedSize = true;
+
+        static constexpr inline size_t size(const VarintContract::Parametric::CursorSession::CursorCallbackExports<Collection>& v)
+        {
+            return TypeInfo<decltype(VarintContract::Parametric::CursorSession::CursorCallbackExports<Collection>::at)>::size(v.at)
+                + TypeInfo<decltype(VarintContract::Parametric::CursorSession::CursorCallbackExports<Collection>::_close)>::size(v._close);
+        }
+
+        template<class S>
+        static inline bool write(S& s, const VarintContract::Parametric::CursorSession::CursorCallbackExports<Collection>& v)
+        {
+            return TypeInfo<decltype(VarintContract::Parametric::CursorSession::CursorCallbackExports<Collection>::at)>::write(s, v.at)
+                && TypeInfo<decltype(VarintContract::Parametric::CursorSession::CursorCallbackExports<Collection>::_close)>::write(s, v._close);
+        }
+
+        template<class S>
+        static inline bool read(S& s, VarintContract::Parametric::CursorSession::CursorCallbackExports<Collection>& v)
+        {
+            return TypeInfo<decltype(VarintContract::Parametric::CursorSession::CursorCallbackExports<Collection>::at)>::read(s, v.at)
+                && TypeInfo<decltype(VarintContract::Parametric::CursorSession::CursorCallbackExports<Collection>::_close)>::read(s, v._close);
+        }
+    };
+}
+
+extern template struct VarintContract::Parametric::Entry<rpc::Many>;
+extern template struct rpc::TypeInfo<VarintContract::Parametric::Entry<rpc::Many>>;
+extern template struct VarintContract::Parametric::CursorSession::CursorCallExports<rpc::Many>;
+extern template struct rpc::TypeInfo<VarintContract::Parametric::CursorSession::CursorCallExports<rpc::Many>>;
+extern template struct VarintContract::Parametric::CursorSession::CursorCallbackExports<rpc::Many>;
+extern template struct rpc::TypeInfo<VarintContract::Parametric::CursorSession::CursorCallbackExports<rpc::Many>>;
+
+struct VarintContract::Types
+{
+    using Id = VarintContract::Parametric::Id<rpc::Many>;
+    using Entry = VarintContract::Parametric::Entry<rpc::Many>;
+    using Ids = VarintContract::Parametric::Ids<rpc::Many>;
+    using LookupFunction = VarintContract::Parametric::LookupFunction<rpc::Many>;
+
+    struct CursorSession
+    {
+        using CursorCallExports = VarintContract::Parametric::CursorSession::CursorCallExports<rpc::Many>;
+        using CursorCallbackExports = VarintContract::Parametric::CursorSession::CursorCallbackExports<rpc::Many>;
+        using OpenAccept = VarintContract::Parametric::CursorSession::OpenAccept<rpc::Many>;
+        using OpenCreate = VarintContract::Parametric::CursorSession::OpenCreate<rpc::Many>;
+        using SeekCall = VarintContract::Parametric::CursorSession::SeekCall<rpc::Many>;
+        using AtCallback = VarintContract::Parametric::CursorSession::AtCallback<rpc::Many>;
+    };
+};
+
+struct VarintContract::Columns
+{
+    template<template<class> class Collection> struct Entry
+    {
+        std::vector<VarintContract::Parametric::Id<Collection>> id;
+        std::vector<uint8_t> small;
+        std::vector<int64_t> delta;
+        std::vector<uint8_t> on;
+        std::vector<uint8_t> off;
+
+        inline size_t size() const { return id.size(); }
+
+        inline void resize(size_t n)
+        {
+            id.resize(n);
+            small.resize(n);
+            delta.resize(n);
+            on.resize(n);
+            off.resize(n);
+        }
+    };
+};
+
+namespace rpc
+{
+    template<template<class> class Collection> struct TypeInfo<VarintContract::Columns::Entry<Collection>>
+    {
+        static constexpr auto sgn = TypeInfo<Collection<VarintContract::Parametric::Entry<Collection>>>::sgn;
+        static constexpr bool isFixedSize = false;
+
+        static inline size_t size(const VarintContract::Columns::Entry<Collection>& v)
+        {
+            auto ret = collectionHeaderSize(v.size()) + v.size() * 2;
+
+            for(size_t i = 0; i < v.size(); i++)
+            {
+                ret += TypeInfo<rpc::Varint<VarintContract::Parametric::Id<Collection>>>::size(rpc::Varint<VarintContract::Parametric::Id<Collection>>::ref(v.id[i]));
+                ret += TypeInfo<rpc::Varint<int64_t>>::size(rpc::Varint<int64_t>::ref(v.delta[i]));
+            }
+
+            return ret;
+        }
+
+        template<class S>
+        static inline bool write(S& s, const VarintContract::Columns::Entry<Collection>& v)
+        {
+            if(!writeCollectionHeader(s, v.size()))
+            {
+                return false;
+            }
+
+            for(size_t i = 0; i < v.size(); i++)
+            {
+                if(!(TypeInfo<rpc::Varint<VarintContract::Parametric::Id<Collection>>>::write(s, rpc::Varint<VarintContract::Parametric::Id<Collection>>::ref(v.id[i]))
+                    && TypeInfo<uint8_t>::write(s, v.small[i])
+                    && TypeInfo<rpc::Varint<int64_t>>::write(s, rpc::Varint<int64_t>::ref(v.delta[i]))
+                    && FlagsInfo<2>::write(s, v.on[i], v.off[i])))
+                {
+                    return false;
+                }
+            }
+
+            return true;
+        }
+
+        template<class S>
+        static inline bool read(S& s, VarintContract::Columns::Entry<Collection>& v)
+        {
+            size_t n;
+
+            if(!readCollectionHeader(s, n))
+            {
+                return false;
+            }
+
+            v.resize(0);
+
+            for(size_t i = 0; i < n; i++)
+            {
+                v.resize(i + 1);
+
+                if(!(TypeInfo<rpc::Varint<VarintContract::Parametric::Id<Collection>>>::read(s, rpc::Varint<VarintContract::Parametric::Id<Collection>>::ref(v.id[i]))
+                    && TypeInfo<uint8_t>::read(s, v.small[i])
+                    && TypeInfo<rpc::Varint<int64_t>>::read(s, rpc::Varint<int64_t>::ref(v.delta[i]))
+                    && FlagsInfo<2>::read(s, v.on[i], v.off[i])))
+                {
+                    return false;
+                }
+            }
+
+            return true;
+        }
+    };
+}
+
+struct VarintContract::Symbols
+{
+    static constexpr inline auto symLookup = rpc::symbol(VarintContract::Types::LookupFunction(), "lookup"_ctstr);
+
+    struct CursorSession
+    {
+        static constexpr inline auto symOpen = rpc::symbol(VarintContract::Types::CursorSession::OpenCreate(), "open"_ctstr);
+    };
+};
+
+
+#endif /* _VARINT_H_ */
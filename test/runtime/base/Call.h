@@ -0,0 +1,19 @@
+#ifndef RPC_TOOL_TEST_RUNTIME_BASE_CALL_H_
+#define RPC_TOOL_TEST_RUNTIME_BASE_CALL_H_
+
+#include "types/TypeInfo.h"
+
+namespace rpc
+{
+	/// Reference to a remote method taking the specified arguments.
+	template<class... Args> struct Call
+	{
+		uint32_t id = 0;
+	};
+
+	template<class... Args> struct TypeInfo<Call<Args...>>: FixedSizeTypeInfo<Call<Args...>, sizeof(uint32_t)> {};
+
+	static constexpr size_t callWireSize = sizeof(uint32_t);
+}
+
+#endif /* RPC_TOOL_TEST_RUNTIME_BASE_CALL_H_ */
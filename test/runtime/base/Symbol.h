@@ -0,0 +1,30 @@
+#ifndef RPC_TOOL_TEST_RUNTIME_BASE_SYMBOL_H_
+#define RPC_TOOL_TEST_RUNTIME_BASE_SYMBOL_H_
+
+#include <cstddef>
+
+namespace rpc
+{
+	/// Compile-time string, the name of a method.
+	struct Name
+	{
+		const char* str;
+		size_t length;
+	};
+
+	/// A method identified by its name and signature.
+	template<class Signature> struct Symbol
+	{
+		Name name;
+	};
+
+	template<class Signature> constexpr inline Symbol<Signature> symbol(Signature, Name name) {
+		return {name};
+	}
+}
+
+constexpr inline rpc::Name operator""_ctstr(const char* str, size_t length) {
+	return {str, length};
+}
+
+#endif /* RPC_TOOL_TEST_RUNTIME_BASE_SYMBOL_H_ */
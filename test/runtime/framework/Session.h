@@ -0,0 +1,6 @@
+#ifndef RPC_TOOL_TEST_RUNTIME_FRAMEWORK_SESSION_H_
+#define RPC_TOOL_TEST_RUNTIME_FRAMEWORK_SESSION_H_
+
+// Nothing of the session framework is used by the generated types (only by the proxies).
+
+#endif /* RPC_TOOL_TEST_RUNTIME_FRAMEWORK_SESSION_H_ */
@@ -0,0 +1,56 @@
+#ifndef RPC_TOOL_TEST_RUNTIME_TYPES_ARRAY_H_
+#define RPC_TOOL_TEST_RUNTIME_TYPES_ARRAY_H_
+
+#include "TypeInfo.h"
+
+#include <array>
+
+namespace rpc
+{
+	/// Fixed number of elements, without any header.
+	template<class T, size_t n> struct TypeInfo<std::array<T, n>>
+	{
+		static constexpr uint32_t sgn = 0x400 + n * TypeInfo<T>::sgn;
+		static constexpr bool isFixedSize = TypeInfo<T>::isFixedSize;
+
+		static constexpr inline size_t size(const std::array<T, n>& v)
+		{
+			size_t ret = 0;
+
+			for(const auto& e: v)
+			{
+				ret += TypeInfo<T>::size(e);
+			}
+
+			return ret;
+		}
+
+		template<class S> static inline bool write(S& s, const std::array<T, n>& v)
+		{
+			for(const auto& e: v)
+			{
+				if(!TypeInfo<T>::write(s, e))
+				{
+					return false;
+				}
+			}
+
+			return true;
+		}
+
+		template<class S> static inline bool read(S& s, std::array<T, n>& v)
+		{
+			for(auto& e: v)
+			{
+				if(!TypeInfo<T>::read(s, e))
+				{
+					return false;
+				}
+			}
+
+			return true;
+		}
+	};
+}
+
+#endif /* RPC_TOOL_TEST_RUNTIME_TYPES_ARRAY_H_ */
@@ -0,0 +1,178 @@
+#ifndef RPC_TOOL_TEST_RUNTIME_TYPES_COLLECTION_H_
+#define RPC_TOOL_TEST_RUNTIME_TYPES_COLLECTION_H_
+
+#include "TypeInfo.h"
+
+#include <vector>
+
+namespace rpc
+{
+	/// Number of bytes the element count of a collection takes on the wire (LEB128 encoded).
+	constexpr inline size_t collectionHeaderSize(size_t n)
+	{
+		size_t ret = 1;
+
+		while(n >>= 7)
+		{
+			ret++;
+		}
+
+		return ret;
+	}
+
+	template<class S> inline bool writeCollectionHeader(S& s, size_t n)
+	{
+		for(;; n >>= 7)
+		{
+			const uint8_t b = (n & 0x7f) | ((n > 0x7f) ? 0x80 : 0);
+
+			if(!s.write(&b, 1))
+			{
+				return false;
+			}
+
+			if(!(b & 0x80))
+			{
+				return true;
+			}
+		}
+	}
+
+	template<class S> inline bool readCollectionHeader(S& s, size_t& n)
+	{
+		n = 0;
+
+		for(auto shift = 0u; shift < 8 * sizeof(uint32_t); shift += 7)
+		{
+			uint8_t b;
+
+			if(!s.read(&b, 1))
+			{
+				return false;
+			}
+
+			n |= (size_t)(b & 0x7f) << shift;
+
+			if(!(b & 0x80))
+			{
+				return true;
+			}
+		}
+
+		return false;
+	}
+
+	/// Owning collection, the one the Types block of the contracts are instantiated with.
+	template<class T> struct Many: std::vector<T>
+	{
+		using std::vector<T>::vector;
+	};
+
+	template<class T> struct TypeInfo<Many<T>>
+	{
+		static constexpr uint32_t sgn = 0x100 + TypeInfo<T>::sgn;
+		static constexpr bool isFixedSize = false;
+
+		static inline size_t size(const Many<T>& v)
+		{
+			auto ret = collectionHeaderSize(v.size());
+
+			for(const auto& e: v)
+			{
+				ret += TypeInfo<T>::size(e);
+			}
+
+			return ret;
+		}
+
+		template<class S> static inline bool write(S& s, const Many<T>& v)
+		{
+			if(!writeCollectionHeader(s, v.size()))
+			{
+				return false;
+			}
+
+			for(const auto& e: v)
+			{
+				if(!TypeInfo<T>::write(s, e))
+				{
+					return false;
+				}
+			}
+
+			return true;
+		}
+
+		template<class S> static inline bool read(S& s, Many<T>& v)
+		{
+			size_t n;
+
+			if(!readCollectionHeader(s, n))
+			{
+				return false;
+			}
+
+			v.resize(n);
+
+			for(auto& e: v)
+			{
+				if(!TypeInfo<T>::read(s, e))
+				{
+					return false;
+				}
+			}
+
+			return true;
+		}
+	};
+
+	/// Non-owning collection, pointing into the buffer the message was received into.
+	template<class T> struct View
+	{
+		const T* data = nullptr;
+		size_t length = 0;
+
+		inline size_t size() const { return length; }
+		inline const T* begin() const { return data; }
+		inline const T* end() const { return data + length; }
+	};
+
+	/// Views are only written here, as there is no receive buffer for them to point into.
+	template<class T> struct TypeInfo<View<T>>
+	{
+		static constexpr uint32_t sgn = TypeInfo<Many<T>>::sgn;
+		static constexpr bool isFixedSize = false;
+
+		static inline size_t size(const View<T>& v)
+		{
+			auto ret = collectionHeaderSize(v.size());
+
+			for(const auto& e: v)
+			{
+				ret += TypeInfo<T>::size(e);
+			}
+
+			return ret;
+		}
+
+		template<class S> static inline bool write(S& s, const View<T>& v)
+		{
+			if(!writeCollectionHeader(s, v.size()))
+			{
+				return false;
+			}
+
+			for(const auto& e: v)
+			{
+				if(!TypeInfo<T>::write(s, e))
+				{
+					return false;
+				}
+			}
+
+			return true;
+		}
+	};
+}
+
+#endif /* RPC_TOOL_TEST_RUNTIME_TYPES_COLLECTION_H_ */
@@ -0,0 +1,45 @@
+#ifndef RPC_TOOL_TEST_RUNTIME_TYPES_FLAGS_H_
+#define RPC_TOOL_TEST_RUNTIME_TYPES_FLAGS_H_
+
+#include "TypeInfo.h"
+
+namespace rpc
+{
+	/// A run of flags packed into bits, taken as plain values (bools or the bytes of a column).
+	template<size_t n> struct FlagsInfo
+	{
+		static constexpr size_t bytes = (n + 7) / 8;
+		static constexpr uint32_t sgn = 0x200 + n;
+		static constexpr bool isFixedSize = true;
+
+		template<class... F> static constexpr inline size_t size(const F&...)
+		{
+			static_assert(sizeof...(F) == n, "Flag count mismatch");
+			return bytes;
+		}
+
+		template<class S, class... F> static inline bool write(S& s, const F&... f)
+		{
+			static_assert(sizeof...(F) == n, "Flag count mismatch");
+			uint8_t bits[bytes] = {}, i = 0;
+			((bits[i / 8] |= (f ? 1 : 0) << (i % 8), i++), ...);
+			return s.write(bits, bytes);
+		}
+
+		template<class S, class... F> static inline bool read(S& s, F&... f)
+		{
+			static_assert(sizeof...(F) == n, "Flag count mismatch");
+			uint8_t bits[bytes], i = 0;
+
+			if(!s.read(bits, bytes))
+			{
+				return false;
+			}
+
+			((f = (bits[i / 8] >> (i % 8)) & 1, i++), ...);
+			return true;
+		}
+	};
+}
+
+#endif /* RPC_TOOL_TEST_RUNTIME_TYPES_FLAGS_H_ */
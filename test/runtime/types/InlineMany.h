@@ -0,0 +1,94 @@
+#ifndef RPC_TOOL_TEST_RUNTIME_TYPES_INLINEMANY_H_
+#define RPC_TOOL_TEST_RUNTIME_TYPES_INLINEMANY_H_
+
+#include "Collection.h"
+
+#include <array>
+#include <algorithm>
+#include <initializer_list>
+
+namespace rpc
+{
+	/// Collection of at most n elements, stored in place.
+	template<class T, size_t n> struct InlineMany
+	{
+		std::array<T, n> elements = {};
+		size_t count = 0;
+
+		static constexpr size_t capacity = n;
+
+		inline InlineMany() = default;
+
+		inline InlineMany(std::initializer_list<T> l): count(l.size()) {
+			std::copy(l.begin(), l.end(), elements.begin());
+		}
+
+		inline size_t size() const { return count; }
+		inline const T* begin() const { return elements.data(); }
+		inline const T* end() const { return elements.data() + count; }
+		inline T* begin() { return elements.data(); }
+		inline T* end() { return elements.data() + count; }
+
+		inline bool resize(size_t k) {
+			return (k <= n) && (count = k, true);
+		}
+	};
+
+	template<class T, size_t n> struct TypeInfo<InlineMany<T, n>>
+	{
+		static constexpr uint32_t sgn = TypeInfo<Many<T>>::sgn;
+		static constexpr bool isFixedSize = false;
+
+		static inline size_t size(const InlineMany<T, n>& v)
+		{
+			auto ret = collectionHeaderSize(v.size());
+
+			for(const auto& e: v)
+			{
+				ret += TypeInfo<T>::size(e);
+			}
+
+			return ret;
+		}
+
+		template<class S> static inline bool write(S& s, const InlineMany<T, n>& v)
+		{
+			if(!writeCollectionHeader(s, v.size()))
+			{
+				return false;
+			}
+
+			for(const auto& e: v)
+			{
+				if(!TypeInfo<T>::write(s, e))
+				{
+					return false;
+				}
+			}
+
+			return true;
+		}
+
+		template<class S> static inline bool read(S& s, InlineMany<T, n>& v)
+		{
+			size_t k;
+
+			if(!readCollectionHeader(s, k) || !v.resize(k))
+			{
+				return false;
+			}
+
+			for(auto& e: v)
+			{
+				if(!TypeInfo<T>::read(s, e))
+				{
+					return false;
+				}
+			}
+
+			return true;
+		}
+	};
+}
+
+#endif /* RPC_TOOL_TEST_RUNTIME_TYPES_INLINEMANY_H_ */
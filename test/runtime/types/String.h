@@ -0,0 +1,57 @@
+#ifndef RPC_TOOL_TEST_RUNTIME_TYPES_STRING_H_
+#define RPC_TOOL_TEST_RUNTIME_TYPES_STRING_H_
+
+#include "Collection.h"
+
+#include <string>
+#include <string_view>
+
+namespace rpc
+{
+	/// Strings are owned along with the collections, or viewed in the receive buffer like them.
+	template<template<class> class Collection> struct StringFor {
+		using Type = std::string;
+	};
+
+	template<> struct StringFor<View> {
+		using Type = std::string_view;
+	};
+
+	template<template<class> class Collection> using String = typename StringFor<Collection>::Type;
+
+	/// Length prefixed UTF-8, on the wire like a collection of bytes.
+	template<class T> struct StringTypeInfo
+	{
+		static constexpr uint32_t sgn = TypeInfo<Many<uint8_t>>::sgn;
+		static constexpr bool isFixedSize = false;
+
+		static inline size_t size(const T& v) {
+			return collectionHeaderSize(v.size()) + v.size();
+		}
+
+		template<class S> static inline bool write(S& s, const T& v) {
+			return writeCollectionHeader(s, v.size()) && s.write(v.data(), v.size());
+		}
+	};
+
+	template<> struct TypeInfo<std::string>: StringTypeInfo<std::string>
+	{
+		template<class S> static inline bool read(S& s, std::string& v)
+		{
+			size_t n;
+
+			if(!readCollectionHeader(s, n))
+			{
+				return false;
+			}
+
+			v.resize(n);
+			return s.read(v.data(), n);
+		}
+	};
+
+	/// Views are only written here, as there is no receive buffer for them to point into.
+	template<> struct TypeInfo<std::string_view>: StringTypeInfo<std::string_view> {};
+}
+
+#endif /* RPC_TOOL_TEST_RUNTIME_TYPES_STRING_H_ */
@@ -0,0 +1,108 @@
+#ifndef RPC_TOOL_TEST_RUNTIME_TYPES_STRUCTTYPEINFO_H_
+#define RPC_TOOL_TEST_RUNTIME_TYPES_STRUCTTYPEINFO_H_
+
+#include "TypeInfo.h"
+#include "Flags.h"
+#include "Varint.h"
+
+namespace rpc
+{
+	template<class C, class M> C classOf(M C::*);
+	template<class C, class M> M memberOf(M C::*);
+
+	/// A single member of an aggregate.
+	template<auto m> struct StructMember
+	{
+		using Class = decltype(classOf(m));
+		using Info = TypeInfo<decltype(memberOf(m))>;
+
+		static constexpr uint32_t sgn = Info::sgn;
+		static constexpr bool isFixedSize = Info::isFixedSize;
+
+		static constexpr inline size_t size(const Class& v) {
+			return Info::size(v.*m);
+		}
+
+		template<class S> static inline bool write(S& s, const Class& v) {
+			return Info::write(s, v.*m);
+		}
+
+		template<class S> static inline bool read(S& s, Class& v) {
+			return Info::read(s, v.*m);
+		}
+	};
+
+	/// A varint encoded member of an aggregate.
+	template<auto m> struct StructVarint
+	{
+		using Class = decltype(classOf(m));
+		using Value = Varint<decltype(memberOf(m))>;
+		using Info = TypeInfo<Value>;
+
+		static constexpr uint32_t sgn = Info::sgn;
+		static constexpr bool isFixedSize = false;
+
+		static inline size_t size(const Class& v) {
+			return Info::size(v.*m);
+		}
+
+		template<class S> static inline bool write(S& s, const Class& v) {
+			return Info::write(s, v.*m);
+		}
+
+		template<class S> static inline bool read(S& s, Class& v)
+		{
+			Value r;
+			return Info::read(s, r) && (v.*m = r, true);
+		}
+	};
+
+	/// A run of flags of an aggregate, packed into bits.
+	template<auto... m> struct StructFlags
+	{
+		using Class = decltype(classOf((m, ...)));
+		using Info = FlagsInfo<sizeof...(m)>;
+
+		static constexpr uint32_t sgn = Info::sgn;
+		static constexpr bool isFixedSize = true;
+
+		static constexpr inline size_t size(const Class& v) {
+			return Info::size(v.*m...);
+		}
+
+		template<class S> static inline bool write(S& s, const Class& v) {
+			return Info::write(s, v.*m...);
+		}
+
+		template<class S> static inline bool read(S& s, Class& v) {
+			return Info::read(s, v.*m...);
+		}
+	};
+
+	/// The aggregate as a sequence of its members.
+	template<class T, class... M> struct StructTypeInfo
+	{
+		static constexpr uint32_t sgn = structSignature(M::sgn...);
+		static constexpr bool isFixedSize = (true && ... && M::isFixedSize);
+
+		static constexpr inline size_t size(const T& v) {
+			return (0 + ... + M::size(v));
+		}
+
+		template<class S> static inline bool write(S& s, const T& v) {
+			return (true && ... && M::write(s, v));
+		}
+
+		template<class S> static inline bool read(S& s, T& v) {
+			return (true && ... && M::read(s, v));
+		}
+	};
+
+	/// Aggregates laid out exactly as on the wire, transferred in one go.
+	template<class T, class... M> struct TrivialStructTypeInfo: FixedSizeTypeInfo<T, sizeof(T)>
+	{
+		static_assert((true && ... && M::isFixedSize), "Trivial aggregates must only have fixed size members");
+	};
+}
+
+#endif /* RPC_TOOL_TEST_RUNTIME_TYPES_STRUCTTYPEINFO_H_ */
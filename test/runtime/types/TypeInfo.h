@@ -0,0 +1,56 @@
+#ifndef RPC_TOOL_TEST_RUNTIME_TYPES_TYPEINFO_H_
+#define RPC_TOOL_TEST_RUNTIME_TYPES_TYPEINFO_H_
+
+#include <cstdint>
+#include <cstddef>
+
+/*
+ * Stand-in for the serialization interface of the runtime, with just enough behind
+ * it for the generated code to be run (the primitives are transferred as they are
+ * in memory, little endian on the hosts the tests run on). A serializer provides:
+ *
+ *  - sgn: the signature of the type (an integer here),
+ *  - isFixedSize: whether all values take the same number of bytes on the wire,
+ *  - size(v): the number of bytes the value takes on the wire,
+ *  - write(s, v) and read(s, v): the transfer of the value through a stream, that
+ *    has write(const void*, size_t) and read(void*, size_t) methods.
+ */
+namespace rpc
+{
+	template<class T> struct TypeInfo;
+
+	/// Combines the signatures of the members of an aggregate.
+	template<class... S> constexpr inline uint32_t structSignature(S... s) {
+		return ((uint32_t)sizeof...(s) + ... + (uint32_t)s);
+	}
+
+	template<class T, size_t n> struct FixedSizeTypeInfo
+	{
+		static constexpr uint32_t sgn = n;
+		static constexpr bool isFixedSize = true;
+
+		static constexpr inline size_t size(const T&) {
+			return n;
+		}
+
+		template<class S> static inline bool write(S& s, const T& v) {
+			return s.write(&v, n);
+		}
+
+		template<class S> static inline bool read(S& s, T& v) {
+			return s.read(&v, n);
+		}
+	};
+
+	template<> struct TypeInfo<bool>: FixedSizeTypeInfo<bool, 1> {};
+	template<> struct TypeInfo<int8_t>: FixedSizeTypeInfo<int8_t, 1> {};
+	template<> struct TypeInfo<uint8_t>: FixedSizeTypeInfo<uint8_t, 1> {};
+	template<> struct TypeInfo<int16_t>: FixedSizeTypeInfo<int16_t, 2> {};
+	template<> struct TypeInfo<uint16_t>: FixedSizeTypeInfo<uint16_t, 2> {};
+	template<> struct TypeInfo<int32_t>: FixedSizeTypeInfo<int32_t, 4> {};
+	template<> struct TypeInfo<uint32_t>: FixedSizeTypeInfo<uint32_t, 4> {};
+	template<> struct TypeInfo<int64_t>: FixedSizeTypeInfo<int64_t, 8> {};
+	template<> struct TypeInfo<uint64_t>: FixedSizeTypeInfo<uint64_t, 8> {};
+}
+
+#endif /* RPC_TOOL_TEST_RUNTIME_TYPES_TYPEINFO_H_ */
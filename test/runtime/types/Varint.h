@@ -0,0 +1,109 @@
+#ifndef RPC_TOOL_TEST_RUNTIME_TYPES_VARINT_H_
+#define RPC_TOOL_TEST_RUNTIME_TYPES_VARINT_H_
+
+#include "TypeInfo.h"
+
+#include <type_traits>
+
+namespace rpc
+{
+	/// Integer encoded by magnitude (LEB128, zigzag for signed ones), converts to and from a plain one.
+	template<class T> struct Varint
+	{
+		static_assert(std::is_integral_v<T> && sizeof(T) >= 4, "Only wide integers are varint encoded");
+
+		T value;
+
+		inline Varint(T value = {}): value(value) {}
+
+		inline operator T() const {
+			return value;
+		}
+
+		/// Views an integer stored as is as its varint encoding.
+		static inline Varint& ref(T& v) {
+			return reinterpret_cast<Varint&>(v);
+		}
+
+		static inline const Varint& ref(const T& v) {
+			return reinterpret_cast<const Varint&>(v);
+		}
+	};
+
+	template<class T> struct TypeInfo<Varint<T>>
+	{
+		using U = std::make_unsigned_t<T>;
+
+		static constexpr uint32_t sgn = 0x300 + sizeof(T);
+		static constexpr bool isFixedSize = false;
+
+		static inline U zigzag(T v)
+		{
+			if constexpr(std::is_signed_v<T>)
+			{
+				return ((U)v << 1) ^ (U)(v >> (8 * sizeof(T) - 1));
+			}
+			else
+			{
+				return v;
+			}
+		}
+
+		static inline size_t size(const Varint<T>& v)
+		{
+			size_t ret = 1;
+
+			for(auto u = zigzag(v.value); u >>= 7;)
+			{
+				ret++;
+			}
+
+			return ret;
+		}
+
+		template<class S> static inline bool write(S& s, const Varint<T>& v)
+		{
+			for(auto u = zigzag(v.value);; u >>= 7)
+			{
+				const uint8_t b = (u & 0x7f) | ((u > 0x7f) ? 0x80 : 0);
+
+				if(!s.write(&b, 1))
+				{
+					return false;
+				}
+
+				if(!(b & 0x80))
+				{
+					return true;
+				}
+			}
+		}
+
+		template<class S> static inline bool read(S& s, Varint<T>& v)
+		{
+			U u = 0;
+
+			for(auto shift = 0u; shift < 8 * sizeof(T); shift += 7)
+			{
+				uint8_t b;
+
+				if(!s.read(&b, 1))
+				{
+					return false;
+				}
+
+				u |= (U)(b & 0x7f) << shift;
+
+				if(!(b & 0x80))
+				{
+					v.value = std::is_signed_v<T> ? (T)((u >> 1) ^ -(u & 1)) : (T)u;
+					return true;
+				}
+			}
+
+			return false;
+		}
+	};
+}
+
+#endif /* RPC_TOOL_TEST_RUNTIME_TYPES_VARINT_H_ */
@@ -0,0 +1,168 @@
+#ifndef RPC_TOOL_TEST_RUNTIME_TYPES_WIRE_H_
+#define RPC_TOOL_TEST_RUNTIME_TYPES_WIRE_H_
+
+#include "base/Call.h"
+
+#include <cstring>
+#include <string_view>
+#include <type_traits>
+
+/*
+ * Stand-ins for the field types of the serialized form, that the builders and the
+ * accessors are generated against. Those of fixed size state it as wireSize, the
+ * others point into the serialized bytes and find out their length from there.
+ */
+namespace rpc
+{
+	/// Reads a field of the specified type from the serialized bytes.
+	template<class T, class = void> struct WireField
+	{
+		static inline T at(const uint8_t* p) {
+			return T(p);
+		}
+
+		static inline size_t length(const uint8_t* p) {
+			return T(p).length();
+		}
+	};
+
+	template<class T> struct WireField<T, std::enable_if_t<std::is_arithmetic_v<T>>>
+	{
+		static inline T at(const uint8_t* p)
+		{
+			T ret;
+			memcpy(&ret, p, sizeof(ret));
+			return ret;
+		}
+
+		static inline size_t length(const uint8_t*) {
+			return sizeof(T);
+		}
+	};
+
+	/// Collection of the serialized elements, optionally bounded.
+	template<class T, size_t n = 0> struct WireMany
+	{
+		const uint8_t* data;
+
+		inline WireMany(const uint8_t* data = nullptr): data(data) {}
+
+		/// Number of elements, from the header.
+		inline size_t size() const
+		{
+			size_t ret = 0;
+
+			for(auto i = 0u; ; i++)
+			{
+				ret |= (size_t)(data[i] & 0x7f) << (7 * i);
+
+				if(!(data[i] & 0x80))
+				{
+					return ret;
+				}
+			}
+		}
+
+		inline T operator[](size_t i) const {
+			return WireField<T>::at(data + position(i));
+		}
+
+		inline size_t length() const {
+			return position(size());
+		}
+
+	private:
+		inline size_t position(size_t i) const
+		{
+			size_t ret = 1;
+
+			while(data[ret - 1] & 0x80)
+			{
+				ret++;
+			}
+
+			while(i--)
+			{
+				ret += WireField<T>::length(data + ret);
+			}
+
+			return ret;
+		}
+	};
+
+	/// Strings point at their characters in the serialized bytes, just like a collection of them.
+	template<> struct WireField<std::string_view>
+	{
+		static inline std::string_view at(const uint8_t* p)
+		{
+			const WireMany<char> chars(p);
+			const auto n = chars.size();
+			return std::string_view((const char*)p + chars.length() - n, n);
+		}
+
+		static inline size_t length(const uint8_t* p) {
+			return WireMany<char>(p).length();
+		}
+	};
+
+	/// Fixed number of serialized elements.
+	template<class T, size_t n> struct WireArray
+	{
+		const uint8_t* data;
+
+		inline WireArray(const uint8_t* data = nullptr): data(data) {}
+
+		inline T operator[](size_t i) const {
+			return WireField<T>::at(data + position(i));
+		}
+
+		inline size_t length() const {
+			return position(n);
+		}
+
+	private:
+		inline size_t position(size_t i) const
+		{
+			size_t ret = 0;
+
+			while(i--)
+			{
+				ret += WireField<T>::length(data + ret);
+			}
+
+			return ret;
+		}
+	};
+
+	/// A run of flags packed into bits.
+	template<size_t n> struct WireFlags
+	{
+		static constexpr size_t wireSize = (n + 7) / 8;
+
+		inline WireFlags(const uint8_t* = nullptr) {}
+
+		inline size_t length() const {
+			return wireSize;
+		}
+	};
+
+	/// References to remote methods, sized by the runtime (so not known to the generator).
+	template<size_t n> struct WireCalls
+	{
+		const uint8_t* data;
+
+		inline WireCalls(const uint8_t* data = nullptr): data(data) {}
+
+		inline uint32_t id(size_t i = 0) const {
+			return WireField<uint32_t>::at(data + i * callWireSize);
+		}
+
+		inline size_t length() const {
+			return n * callWireSize;
+		}
+	};
+
+	using WireCall = WireCalls<1>;
+}
+
+#endif /* RPC_TOOL_TEST_RUNTIME_TYPES_WIRE_H_ */
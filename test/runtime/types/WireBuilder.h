@@ -0,0 +1,51 @@
+#ifndef RPC_TOOL_TEST_RUNTIME_TYPES_WIREBUILDER_H_
+#define RPC_TOOL_TEST_RUNTIME_TYPES_WIREBUILDER_H_
+
+#include "Wire.h"
+#include "Collection.h"
+
+/*
+ * Stand-in for the writer interface the builders are generated against. Each operation
+ * writes a field into the output and hands over to the builder of the next stage. The
+ * elements of collections and the fields of nested aggregates are written in between,
+ * through their own builders (or serializers). The flags are set in the last byte
+ * of the output, so it provides access to that through back().
+ */
+namespace rpc
+{
+	template<class Out> struct WireBuilder
+	{
+		Out& out;
+
+		inline WireBuilder(Out& out): out(out) {}
+
+	protected:
+		template<class Next, class T> inline Next put(const T& v) {
+			return TypeInfo<T>::write(out, v), Next(out);
+		}
+
+		template<class Next, size_t bit, size_t count> inline Next putFlag(bool v)
+		{
+			static_assert(bit < count, "Flag out of its run");
+
+			if(bit % 8 == 0)
+			{
+				const uint8_t b = 0;
+				out.write(&b, 1);
+			}
+
+			out.back() |= (v ? 1 : 0) << (bit % 8);
+			return Next(out);
+		}
+
+		template<class Next, class E, size_t capacity = 0> inline Next reserve(size_t n) {
+			return writeCollectionHeader(out, n), Next(out);
+		}
+
+		template<class Next, class Nested> inline Next nest() {
+			return Next(out);
+		}
+	};
+}
+
+#endif /* RPC_TOOL_TEST_RUNTIME_TYPES_WIREBUILDER_H_ */
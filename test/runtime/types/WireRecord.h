@@ -0,0 +1,88 @@
+#ifndef RPC_TOOL_TEST_RUNTIME_TYPES_WIRERECORD_H_
+#define RPC_TOOL_TEST_RUNTIME_TYPES_WIRERECORD_H_
+
+#include "Wire.h"
+
+#include <tuple>
+
+/*
+ * Stand-in for the reader interface the accessors are generated against. The offsets of
+ * the fields are worked out from their types here, so that the ones passed by the generated
+ * accessors are checked, along with whether every offset known in advance is passed. The
+ * fields after one of variable size are found by walking the serialized bytes.
+ */
+namespace rpc
+{
+	static constexpr size_t variableSize = (size_t)-1;
+
+	template<class T, class = void> struct WireSize {
+		static constexpr size_t value = std::is_arithmetic_v<T> ? sizeof(T) : variableSize;
+	};
+
+	template<class T> struct WireSize<T, std::void_t<decltype(T::wireSize)>> {
+		static constexpr size_t value = T::wireSize;
+	};
+
+	template<class T, size_t n> struct WireSize<WireArray<T, n>> {
+		static constexpr size_t value = (WireSize<T>::value == variableSize) ? variableSize : n * WireSize<T>::value;
+	};
+
+	template<class... F> struct WireRecord
+	{
+		const uint8_t* data;
+
+		inline WireRecord(const uint8_t* data = nullptr): data(data) {}
+
+		template<size_t i> static constexpr inline size_t offset()
+		{
+			if constexpr(i == 0)
+			{
+				return 0;
+			}
+			else
+			{
+				constexpr auto before = offset<i - 1>();
+				constexpr auto size = WireSize<Field<i - 1>>::value;
+				return (before == variableSize || size == variableSize) ? variableSize : before + size;
+			}
+		}
+
+		/// Total size of the fields, if all of them are of fixed size.
+		static constexpr size_t fixedSize = offset<sizeof...(F)>();
+
+		/// Number of bytes the record takes on the wire.
+		inline size_t length() const {
+			return position<sizeof...(F)>();
+		}
+
+	protected:
+		template<size_t i> using Field = std::tuple_element_t<i, std::tuple<F...>>;
+
+		template<size_t i> inline size_t position() const
+		{
+			if constexpr(offset<i>() != variableSize)
+			{
+				return offset<i>();
+			}
+			else
+			{
+				return position<i - 1>() + WireField<Field<i - 1>>::length(data + position<i - 1>());
+			}
+		}
+
+		template<size_t i, size_t o = variableSize> inline auto field() const
+		{
+			static_assert(o == offset<i>(), "Field offset mismatch");
+			return WireField<Field<i>>::at(data + position<i>());
+		}
+
+		template<size_t i, size_t j, size_t o = variableSize> inline bool flag() const
+		{
+			static_assert(o == offset<i>(), "Flag offset mismatch");
+			static_assert(j < 8 * Field<i>::wireSize, "Flag out of its run");
+			return (data[position<i>() + j / 8] >> (j % 8)) & 1;
+		}
+	};
+}
+
+#endif /* RPC_TOOL_TEST_RUNTIME_TYPES_WIRERECORD_H_ */